@@ -0,0 +1,318 @@
+/**
+ * \file Ifx_CanRxDispatch.c
+ * \brief CAN receive dispatch module implementation file
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2026-10-17 09:00:00 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_CanRxDispatch.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** \brief Returns the key of a message ID */
+IFX_INLINE uint32 Ifx_CanRxDispatch_getKey(uint32 id, IfxCan_MessageIdLength idLength)
+{
+    return (idLength == IfxCan_MessageIdLength_extended) ? (id | IFX_CANRXDISPATCH_EXTENDED) : id;
+}
+
+
+/** \brief Returns TRUE if the entry is an exact ID entry */
+IFX_INLINE boolean Ifx_CanRxDispatch_isExact(const Ifx_CanRxDispatch_Entry *entry)
+{
+    return entry->mask == (IFX_CANRXDISPATCH_EXTENDED | IFX_CANRXDISPATCH_MASK_ALL);
+}
+
+
+/** \brief Sort order of the table: exact entries by key, then the masked entries */
+IFX_INLINE boolean Ifx_CanRxDispatch_isBefore(const Ifx_CanRxDispatch_Entry *a, const Ifx_CanRxDispatch_Entry *b)
+{
+    boolean result;
+
+    if (Ifx_CanRxDispatch_isExact(a))
+    {
+        result = !Ifx_CanRxDispatch_isExact(b) || (a->key < b->key);
+    }
+    else
+    {
+        result = FALSE;
+    }
+
+    return result;
+}
+
+
+/** \brief Write a message into a mailbox */
+static void Ifx_CanRxDispatch_writeMailbox(Ifx_CanRxDispatch_Mailbox *mailbox, const IfxCan_Message *message, const uint32 *data)
+{
+    uint32 sequence = mailbox->sequence;
+    uint32 length   = __minu(IfxCan_Node_getDataLength(message->dataLengthCode), IFX_CANRXDISPATCH_MAX_DATA);
+    uint32 i;
+
+    mailbox->sequence = sequence + 1;
+    __dsync();
+
+    mailbox->message = *message;
+
+    for (i = 0; i < length; i++)
+    {
+        mailbox->data[i] = data[i];
+    }
+
+    __dsync();
+    mailbox->sequence = sequence + 2;
+}
+
+
+void Ifx_CanRxDispatch_init(Ifx_CanRxDispatch *dispatch, Ifx_CanRxDispatch_Entry *entries, uint16 maxCount)
+{
+    dispatch->entries        = entries;
+    dispatch->maxCount       = maxCount;
+    dispatch->count          = 0;
+    dispatch->exactCount     = 0;
+    dispatch->built          = FALSE;
+    dispatch->defaultHandler = NULL_PTR;
+    dispatch->defaultContext = NULL_PTR;
+    dispatch->dispatched     = 0;
+    dispatch->unmatched      = 0;
+}
+
+
+boolean Ifx_CanRxDispatch_add(Ifx_CanRxDispatch *dispatch, uint32 id, IfxCan_MessageIdLength idLength, uint32 mask, Ifx_CanRxDispatch_Handler handler, void *context, Ifx_CanRxDispatch_Mailbox *mailbox)
+{
+    boolean result = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, dispatch->built == FALSE);
+
+    if (dispatch->count < dispatch->maxCount)
+    {
+        Ifx_CanRxDispatch_Entry *entry = &dispatch->entries[dispatch->count];
+
+        mask &= IFX_CANRXDISPATCH_MASK_ALL;
+
+        if (idLength != IfxCan_MessageIdLength_both)
+        {   /* the frame format is part of the match */
+            mask |= IFX_CANRXDISPATCH_EXTENDED;
+        }
+
+        entry->key      = Ifx_CanRxDispatch_getKey(id, idLength) & mask;
+        entry->mask     = mask;
+        entry->handler  = handler;
+        entry->context  = context;
+        entry->mailbox  = mailbox;
+        dispatch->count++;
+
+        result = TRUE;
+    }
+
+    return result;
+}
+
+
+void Ifx_CanRxDispatch_setDefaultHandler(Ifx_CanRxDispatch *dispatch, Ifx_CanRxDispatch_Handler handler, void *context)
+{
+    dispatch->defaultHandler = handler;
+    dispatch->defaultContext = context;
+}
+
+
+void Ifx_CanRxDispatch_build(Ifx_CanRxDispatch *dispatch)
+{
+    Ifx_CanRxDispatch_Entry *entries = dispatch->entries;
+    uint32                   i, j;
+
+    /* Insertion sort, stable: the first added of equal keys comes first and the masked entries
+     * keep the order of addition. Done once at initialisation. */
+    for (i = 1; i < dispatch->count; i++)
+    {
+        Ifx_CanRxDispatch_Entry entry = entries[i];
+
+        for (j = i; (j > 0) && Ifx_CanRxDispatch_isBefore(&entry, &entries[j - 1]); j--)
+        {
+            entries[j] = entries[j - 1];
+        }
+
+        entries[j] = entry;
+    }
+
+    for (i = 0; (i < dispatch->count) && Ifx_CanRxDispatch_isExact(&entries[i]); i++)
+    {}
+
+    dispatch->exactCount = (uint16)i;
+    dispatch->built      = TRUE;
+}
+
+
+Ifx_CanRxDispatch_Entry *Ifx_CanRxDispatch_find(const Ifx_CanRxDispatch *dispatch, uint32 id, IfxCan_MessageIdLength idLength)
+{
+    Ifx_CanRxDispatch_Entry *entries = dispatch->entries;
+    Ifx_CanRxDispatch_Entry *result  = NULL_PTR;
+    uint32                   key     = Ifx_CanRxDispatch_getKey(id, idLength);
+    uint32                   base    = 0;
+    uint32                   count   = dispatch->exactCount;
+    uint32                   i;
+
+    /* lower bound of key in the exact entries. Branch free, the number of iterations only depends on
+     * the table size */
+    while (count > 1)
+    {
+        uint32 half = count >> 1;
+
+        base   = (entries[base + half - 1].key < key) ? (base + half) : base;
+        count -= half;
+    }
+
+    if ((count != 0) && (entries[base].key == key))
+    {
+        result = &entries[base];
+    }
+    else
+    {
+        for (i = dispatch->exactCount; i < dispatch->count; i++)
+        {
+            if ((key & entries[i].mask) == entries[i].key)
+            {
+                result = &entries[i];
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+
+boolean Ifx_CanRxDispatch_process(Ifx_CanRxDispatch *dispatch, const IfxCan_Message *message, const uint32 *data)
+{
+    Ifx_CanRxDispatch_Entry *entry;
+    boolean                  interruptState;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, dispatch->built != FALSE);
+
+    entry = Ifx_CanRxDispatch_find(dispatch, message->messageId, message->messageIdLength);
+
+    if (entry != NULL_PTR)
+    {
+        if (entry->mailbox != NULL_PTR)
+        {
+            Ifx_CanRxDispatch_writeMailbox(entry->mailbox, message, data);
+        }
+
+        if (entry->handler != NULL_PTR)
+        {
+            entry->handler(entry->context, message, data);
+        }
+
+        /* the counters are shared by the receive interrupts of all the nodes using the table */
+        interruptState = IfxCpu_disableInterrupts();
+        dispatch->dispatched++;
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+    else
+    {
+        if (dispatch->defaultHandler != NULL_PTR)
+        {
+            dispatch->defaultHandler(dispatch->defaultContext, message, data);
+        }
+
+        interruptState = IfxCpu_disableInterrupts();
+        dispatch->unmatched++;
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    return entry != NULL_PTR;
+}
+
+
+uint32 Ifx_CanRxDispatch_processFifo(Ifx_CanRxDispatch *dispatch, IfxCan_Can_Node *node, IfxCan_RxFifo fifo)
+{
+    IfxCan_Message messages[IFX_CFG_CANRXDISPATCH_BATCH_SIZE];
+    uint32         data[IFX_CFG_CANRXDISPATCH_BATCH_SIZE * IFX_CANRXDISPATCH_MAX_DATA];
+    uint32         slotSize, count, i;
+    uint32         total = 0;
+
+    if (fifo == IfxCan_RxFifo_0)
+    {
+        slotSize = IfxCan_Node_getRxFifo0DataFieldSize(node->node) / 4;
+    }
+    else
+    {
+        slotSize = IfxCan_Node_getRxFifo1DataFieldSize(node->node) / 4;
+    }
+
+    do
+    {
+        count = IfxCan_Can_readFifoBatch(node, fifo, messages, data, IFX_CFG_CANRXDISPATCH_BATCH_SIZE);
+
+        for (i = 0; i < count; i++)
+        {
+            Ifx_CanRxDispatch_process(dispatch, &messages[i], &data[i * slotSize]);
+        }
+
+        total += count;
+    } while (count == IFX_CFG_CANRXDISPATCH_BATCH_SIZE);
+
+    return total;
+}
+
+
+boolean Ifx_CanRxDispatch_readMailbox(const Ifx_CanRxDispatch_Mailbox *mailbox, IfxCan_Message *message, uint32 *data, uint32 *sequence)
+{
+    uint32  before, after, i;
+    boolean result;
+
+    do
+    {
+        before = mailbox->sequence;
+        __dsync();
+        *message = mailbox->message;
+
+        for (i = 0; i < IFX_CANRXDISPATCH_MAX_DATA; i++)
+        {
+            data[i] = mailbox->data[i];
+        }
+
+        __dsync();
+        after = mailbox->sequence;
+    } while ((before != after) || ((before & 1) != 0));
+
+    result    = (before != *sequence);
+    *sequence = before;
+
+    return result;
+}
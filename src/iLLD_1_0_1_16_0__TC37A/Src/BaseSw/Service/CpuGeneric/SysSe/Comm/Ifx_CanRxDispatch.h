@@ -0,0 +1,221 @@
+/**
+ * \file Ifx_CanRxDispatch.h
+ * \brief CAN receive dispatch module header file
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2026-10-17 09:00:00 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_comm_canRxDispatch CAN receive dispatch
+ * This module routes the messages received by an \ref IfxCan_Can_Node to their consumers, so that the
+ * application does not need to switch on the message ID.
+ *
+ * The dispatch table maps IDs, or IDs and masks, to a handler and / or a latest-value mailbox. It is
+ * filled with \ref Ifx_CanRxDispatch_add() and built once with \ref Ifx_CanRxDispatch_build() during
+ * initialisation. Once built, the table is read only and can be used from the receive interrupt without lock.
+ *
+ * Look-up:
+ * - exact IDs are sorted and binary searched: at most log2(n) + 1 key compares, e.g. 11 for 2000 IDs.
+ * - masked entries are then checked in the order of addition, their number should be kept small.
+ * - standard and extended IDs are distinct keys, unless the entry is added with \ref IfxCan_MessageIdLength_both.
+ *
+ * \code
+ *     Ifx_CanRxDispatch         dispatch;
+ *     Ifx_CanRxDispatch_Entry   entries[200];
+ *     Ifx_CanRxDispatch_Mailbox speedMailbox;
+ *
+ *     Ifx_CanRxDispatch_init(&dispatch, entries, 200);
+ *     Ifx_CanRxDispatch_add(&dispatch, 0x123, IfxCan_MessageIdLength_standard, IFX_CANRXDISPATCH_MASK_ALL, NULL_PTR, NULL_PTR, &speedMailbox);
+ *     Ifx_CanRxDispatch_add(&dispatch, 0x18FF0000, IfxCan_MessageIdLength_extended, 0x1FFF0000, onJ1939, &j1939, NULL_PTR);
+ *     Ifx_CanRxDispatch_build(&dispatch);
+ *
+ *     // receive interrupt:
+ *     Ifx_CanRxDispatch_processFifo(&dispatch, &canNode, IfxCan_RxFifo_0);
+ *
+ *     // task:
+ *     if (Ifx_CanRxDispatch_readMailbox(&speedMailbox, &message, data, &lastSequence))
+ *     {
+ *         // new value
+ *     }
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_comm
+ *
+ */
+#ifndef IFX_CANRXDISPATCH_H
+#define IFX_CANRXDISPATCH_H 1
+
+#include "Can/Can/IfxCan_Can.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_CANRXDISPATCH_BATCH_SIZE)
+#define IFX_CFG_CANRXDISPATCH_BATCH_SIZE (4) /**<\brief Number of messages read from the FIFO at once by \ref Ifx_CanRxDispatch_processFifo() */
+#endif
+
+#define IFX_CANRXDISPATCH_EXTENDED     (0x80000000u) /**<\brief Key flag of the extended IDs */
+#define IFX_CANRXDISPATCH_MASK_ALL     (0x1FFFFFFFu) /**<\brief Mask for an exact ID match */
+#define IFX_CANRXDISPATCH_MAX_DATA     (16)          /**<\brief Size of the mailbox data in words (64 bytes) */
+
+/** \brief Message handler
+ * \param context Context given to \ref Ifx_CanRxDispatch_add()
+ * \param message Received message
+ * \param data Received data (in words)
+ */
+typedef void (*Ifx_CanRxDispatch_Handler)(void *context, const IfxCan_Message *message, const uint32 *data);
+
+/** \brief Latest-value mailbox
+ *
+ * Single writer (the dispatch), any number of readers. sequence is odd while the mailbox is written
+ * and is incremented by 2 for each message.
+ */
+typedef struct
+{
+    volatile uint32 sequence;                          /**<\brief Write sequence, odd while the mailbox is written */
+    IfxCan_Message  message;                           /**<\brief Latest message */
+    uint32          data[IFX_CANRXDISPATCH_MAX_DATA];  /**<\brief Latest data */
+} Ifx_CanRxDispatch_Mailbox;
+
+typedef struct
+{
+    uint32                     key;          /**<\brief ID, with \ref IFX_CANRXDISPATCH_EXTENDED set for the extended IDs */
+    uint32                     mask;         /**<\brief Bits of the key which shall match */
+    Ifx_CanRxDispatch_Handler  handler;      /**<\brief Handler, or NULL_PTR */
+    void                      *context;      /**<\brief Handler context */
+    Ifx_CanRxDispatch_Mailbox *mailbox;      /**<\brief Mailbox, or NULL_PTR */
+} Ifx_CanRxDispatch_Entry;
+
+typedef struct
+{
+    Ifx_CanRxDispatch_Entry  *entries;         /**<\brief Table, exact entries sorted by key followed by the masked entries */
+    uint16                    maxCount;        /**<\brief Size of the table */
+    uint16                    count;           /**<\brief Number of entries */
+    uint16                    exactCount;      /**<\brief Number of exact entries, valid once built */
+    boolean                   built;           /**<\brief TRUE once \ref Ifx_CanRxDispatch_build() is called */
+    Ifx_CanRxDispatch_Handler defaultHandler;  /**<\brief Handler of the unmatched messages, or NULL_PTR */
+    void                     *defaultContext;  /**<\brief Context of defaultHandler */
+    uint32                    dispatched;      /**<\brief Number of messages matched by an entry */
+    uint32                    unmatched;       /**<\brief Number of messages matched by no entry */
+} Ifx_CanRxDispatch;
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_comm_canRxDispatch
+ * \{ */
+
+/**
+ * \brief Initialize the dispatch object with an empty table.
+ * \param dispatch Pointer to the dispatch object
+ * \param entries Table memory, maxCount entries
+ * \param maxCount Size of the table
+ */
+IFX_EXTERN void Ifx_CanRxDispatch_init(Ifx_CanRxDispatch *dispatch, Ifx_CanRxDispatch_Entry *entries, uint16 maxCount);
+
+/**
+ * \brief Add an entry to the table. Shall be called before \ref Ifx_CanRxDispatch_build().
+ * \param dispatch Pointer to the dispatch object
+ * \param id Message ID
+ * \param idLength Standard or extended ID. \ref IfxCan_MessageIdLength_both matches both formats
+ * \param mask Bits of the ID which shall match, \ref IFX_CANRXDISPATCH_MASK_ALL for an exact ID
+ * \param handler Handler called for each message, or NULL_PTR
+ * \param context Handler context
+ * \param mailbox Mailbox updated with each message, or NULL_PTR
+ * \retval TRUE if the entry is added
+ * \retval FALSE if the table is full
+ */
+IFX_EXTERN boolean Ifx_CanRxDispatch_add(Ifx_CanRxDispatch *dispatch, uint32 id, IfxCan_MessageIdLength idLength, uint32 mask, Ifx_CanRxDispatch_Handler handler, void *context, Ifx_CanRxDispatch_Mailbox *mailbox);
+
+/**
+ * \brief Set the handler of the messages matched by no entry.
+ * \param dispatch Pointer to the dispatch object
+ * \param handler Handler, or NULL_PTR
+ * \param context Handler context
+ */
+IFX_EXTERN void Ifx_CanRxDispatch_setDefaultHandler(Ifx_CanRxDispatch *dispatch, Ifx_CanRxDispatch_Handler handler, void *context);
+
+/**
+ * \brief Build the table. After this call, the table is read only.
+ *
+ * Exact entries are sorted by key, masked entries keep the order of addition.
+ * When several exact entries have the same key, the first added is used.
+ * \param dispatch Pointer to the dispatch object
+ */
+IFX_EXTERN void Ifx_CanRxDispatch_build(Ifx_CanRxDispatch *dispatch);
+
+/**
+ * \brief Returns the entry matching a message ID.
+ * \param dispatch Pointer to the dispatch object
+ * \param id Message ID
+ * \param idLength Standard or extended ID
+ * \return Entry, or NULL_PTR if no entry matches
+ */
+IFX_EXTERN Ifx_CanRxDispatch_Entry *Ifx_CanRxDispatch_find(const Ifx_CanRxDispatch *dispatch, uint32 id, IfxCan_MessageIdLength idLength);
+
+/**
+ * \brief Dispatch a received message: update the mailbox and call the handler of the matching entry.
+ * \param dispatch Pointer to the dispatch object
+ * \param message Received message
+ * \param data Received data (in words)
+ * \retval TRUE if an entry matched
+ * \retval FALSE if no entry matched, the default handler is called if set
+ */
+IFX_EXTERN boolean Ifx_CanRxDispatch_process(Ifx_CanRxDispatch *dispatch, const IfxCan_Message *message, const uint32 *data);
+
+/**
+ * \brief Read and dispatch all messages of an Rx FIFO, see \ref IfxCan_Can_readFifoBatch().
+ * To be called from the FIFO receive interrupt.
+ * \param dispatch Pointer to the dispatch object
+ * \param node CAN Node handle
+ * \param fifo Rx FIFO to be read
+ * \return Number of messages read
+ */
+IFX_EXTERN uint32 Ifx_CanRxDispatch_processFifo(Ifx_CanRxDispatch *dispatch, IfxCan_Can_Node *node, IfxCan_RxFifo fifo);
+
+/**
+ * \brief Read a consistent copy of a mailbox.
+ *
+ * Retries while the mailbox is being written, therefore it shall not be called from a context which
+ * preempts the dispatch (e.g. a higher priority interrupt). If the reader runs on another CPU, the
+ * mailbox shall be located in non-cached memory.
+ * \param mailbox Pointer to the mailbox
+ * \param message Copy of the latest message
+ * \param data Copy of the latest data, \ref IFX_CANRXDISPATCH_MAX_DATA words
+ * \param sequence In: sequence of the previous read, out: sequence of this read. Initialise with 0
+ * \retval TRUE if a message was received since the previous read
+ * \retval FALSE if no message was received since the previous read
+ */
+IFX_EXTERN boolean Ifx_CanRxDispatch_readMailbox(const Ifx_CanRxDispatch_Mailbox *mailbox, IfxCan_Message *message, uint32 *data, uint32 *sequence);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
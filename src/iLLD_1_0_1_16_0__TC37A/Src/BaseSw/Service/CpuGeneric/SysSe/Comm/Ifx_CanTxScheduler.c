@@ -0,0 +1,414 @@
+/**
+ * \file Ifx_CanTxScheduler.c
+ * \brief CAN transmit scheduler module implementation file
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2026-10-17 09:00:00 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_CanTxScheduler.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Stm/Std/IfxStm.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/**
+ * \brief Returns the arbitration priority of a message ID, lower first.
+ * Same order as on the bus: base ID, then standard before extended with the same base ID, then ID extension.
+ */
+IFX_INLINE uint32 Ifx_CanTxScheduler_getKey(uint32 id, IfxCan_MessageIdLength idLength)
+{
+    return (idLength == IfxCan_MessageIdLength_extended) ? (((id & 0x1FFFFFFFu) << 1) | 1u) : ((id & 0x7FFu) << 19);
+}
+
+
+/** \brief Returns TRUE if a shall be sent before b */
+IFX_INLINE boolean Ifx_CanTxScheduler_isBefore(const Ifx_CanTxScheduler_Frame *a, const Ifx_CanTxScheduler_Frame *b)
+{
+    return (a->key < b->key) || ((a->key == b->key) && ((sint32)(a->sequence - b->sequence) < 0));
+}
+
+
+/** \brief Insert the frame written at frames[heap[queueDepth]] into the heap */
+static void Ifx_CanTxScheduler_push(Ifx_CanTxScheduler *scheduler)
+{
+    Ifx_CanTxScheduler_Frame *frames = scheduler->frames;
+    uint16                   *heap   = scheduler->heap;
+    uint32                    i      = scheduler->statistics.queueDepth;
+    uint16                    index  = heap[i];
+
+    while (i > 0)
+    {
+        uint32 parent = (i - 1) >> 1;
+
+        if (!Ifx_CanTxScheduler_isBefore(&frames[index], &frames[heap[parent]]))
+        {
+            break;
+        }
+
+        heap[i] = heap[parent];
+        i       = parent;
+    }
+
+    heap[i] = index;
+    scheduler->statistics.queueDepth++;
+    scheduler->statistics.maxQueueDepth = __max(scheduler->statistics.maxQueueDepth, scheduler->statistics.queueDepth);
+}
+
+
+/** \brief Remove the frame at the given heap position into frame */
+static void Ifx_CanTxScheduler_remove(Ifx_CanTxScheduler *scheduler, uint32 position, Ifx_CanTxScheduler_Frame *frame)
+{
+    Ifx_CanTxScheduler_Frame *frames  = scheduler->frames;
+    uint16                   *heap    = scheduler->heap;
+    uint32                    count   = scheduler->statistics.queueDepth - 1;
+    uint16                    removed = heap[position];
+    uint16                    last    = heap[count];
+    uint32                    i       = position;
+    uint32                    child;
+
+    *frame = frames[removed];
+
+    /* the index of the removed frame goes to the free part of the heap array */
+    heap[count] = removed;
+
+    if (i < count)
+    {   /* the last frame takes the place of the removed one, then moves up or down */
+        while ((i > 0) && Ifx_CanTxScheduler_isBefore(&frames[last], &frames[heap[(i - 1) >> 1]]))
+        {
+            heap[i] = heap[(i - 1) >> 1];
+            i       = (i - 1) >> 1;
+        }
+
+        while ((child = (2 * i) + 1) < count)
+        {
+            if (((child + 1) < count) && Ifx_CanTxScheduler_isBefore(&frames[heap[child + 1]], &frames[heap[child]]))
+            {
+                child++;
+            }
+
+            if (!Ifx_CanTxScheduler_isBefore(&frames[heap[child]], &frames[last]))
+            {
+                break;
+            }
+
+            heap[i] = heap[child];
+            i       = child;
+        }
+
+        heap[i] = last;
+    }
+
+    scheduler->statistics.queueDepth = (uint16)count;
+}
+
+
+/** \brief Returns TRUE if a frame with this key is pending or being cancelled in a Tx buffer */
+static boolean Ifx_CanTxScheduler_isInBuffer(const Ifx_CanTxScheduler *scheduler, uint32 key)
+{
+    boolean result = FALSE;
+    uint32  i;
+
+    for (i = 0; (i < scheduler->bufferCount) && (result == FALSE); i++)
+    {
+        result = (scheduler->state[i] != Ifx_CanTxScheduler_BufferState_free) && (scheduler->buffer[i].key == key);
+    }
+
+    return result;
+}
+
+
+/**
+ * \brief Returns the heap position of the first queued frame whose ID is not in a Tx buffer, -1 if none.
+ * Only the children of such a frame can come before it, so the other subtrees are skipped.
+ */
+static sint32 Ifx_CanTxScheduler_findFirst(const Ifx_CanTxScheduler *scheduler)
+{
+    const Ifx_CanTxScheduler_Frame *frames   = scheduler->frames;
+    const uint16                   *heap     = scheduler->heap;
+    sint32                          position = -1;
+    uint32                          i;
+
+    /* stops at once if the first frame can be loaded */
+    for (i = 0; (i < scheduler->statistics.queueDepth) && (position != 0); i++)
+    {
+        const Ifx_CanTxScheduler_Frame *frame = &frames[heap[i]];
+
+        if (((i == 0) || Ifx_CanTxScheduler_isInBuffer(scheduler, frames[heap[(i - 1) >> 1]].key))
+            && !Ifx_CanTxScheduler_isInBuffer(scheduler, frame->key)
+            && ((position < 0) || Ifx_CanTxScheduler_isBefore(frame, &frames[heap[position]])))
+        {
+            position = (sint32)i;
+        }
+    }
+
+    return position;
+}
+
+
+/** \brief Write the queued frame at the given heap position into a free Tx buffer */
+static void Ifx_CanTxScheduler_load(Ifx_CanTxScheduler *scheduler, uint32 slot, uint32 position)
+{
+    Ifx_CanTxScheduler_Frame *frame = &scheduler->buffer[slot];
+
+    Ifx_CanTxScheduler_remove(scheduler, position, frame);
+    frame->message.bufferNumber       = (uint8)(scheduler->firstBuffer + slot);
+    frame->message.storeInTxFifoQueue = FALSE;
+    IfxCan_Can_sendMessage(scheduler->node, &frame->message, frame->data);
+    scheduler->state[slot] = Ifx_CanTxScheduler_BufferState_pending;
+}
+
+
+/**
+ * \brief Refill the free Tx buffers from the queue, or cancel the lowest priority pending buffer if
+ * all buffers are pending and the first queued frame has a higher priority.
+ * Frames whose ID is already in a Tx buffer are skipped, the frames with other IDs are loaded.
+ * Shall be called with the interrupts disabled.
+ */
+static void Ifx_CanTxScheduler_refill(Ifx_CanTxScheduler *scheduler)
+{
+    while (scheduler->statistics.queueDepth > 0)
+    {
+        sint32  position   = Ifx_CanTxScheduler_findFirst(scheduler);
+        sint32  freeSlot   = -1;
+        sint32  lowest     = -1;
+        boolean cancelling = FALSE;
+        uint32  i;
+
+        if (position < 0)
+        {   /* only one frame per ID in the hardware, keeps the order of the frames with the same ID */
+            break;
+        }
+
+        for (i = 0; i < scheduler->bufferCount; i++)
+        {
+            if (scheduler->state[i] == Ifx_CanTxScheduler_BufferState_free)
+            {
+                freeSlot = (freeSlot < 0) ? (sint32)i : freeSlot;
+            }
+            else if (scheduler->state[i] == Ifx_CanTxScheduler_BufferState_cancelling)
+            {
+                cancelling = TRUE;
+            }
+            else if ((lowest < 0) || Ifx_CanTxScheduler_isBefore(&scheduler->buffer[lowest], &scheduler->buffer[i]))
+            {
+                lowest = (sint32)i;
+            }
+            else
+            {}
+        }
+
+        if (freeSlot >= 0)
+        {
+            Ifx_CanTxScheduler_load(scheduler, (uint32)freeSlot, (uint32)position);
+        }
+        else
+        {
+            Ifx_CanTxScheduler_Frame *first      = &scheduler->frames[scheduler->heap[position]];
+            boolean                   canReserve = ((scheduler->statistics.queueDepth + scheduler->cancelling) < scheduler->queueSize) ? TRUE : FALSE;
+
+            if ((cancelling == FALSE) && (canReserve != FALSE) && (lowest >= 0) && Ifx_CanTxScheduler_isBefore(first, &scheduler->buffer[lowest]))
+            {   /* priority inversion: the frame is queued again by Ifx_CanTxScheduler_update() once cancelled, in the reserved entry */
+                IfxCan_Node_setTxBufferCancellationRequest(scheduler->node->node, (IfxCan_TxBufferId)(scheduler->firstBuffer + lowest));
+                scheduler->state[lowest] = Ifx_CanTxScheduler_BufferState_cancelling;
+                scheduler->cancelling++;
+                scheduler->statistics.cancelled++;
+            }
+
+            break;
+        }
+    }
+}
+
+
+void Ifx_CanTxScheduler_initConfig(Ifx_CanTxScheduler_Config *config, IfxCan_Can_Node *node)
+{
+    config->node        = node;
+    config->firstBuffer = IfxCan_TxBufferId_0;
+    config->bufferCount = 4;
+    config->frames      = NULL_PTR;
+    config->heap        = NULL_PTR;
+    config->queueSize   = 0;
+}
+
+
+void Ifx_CanTxScheduler_init(Ifx_CanTxScheduler *scheduler, const Ifx_CanTxScheduler_Config *config)
+{
+    uint32 i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->bufferCount <= IFX_CFG_CANTXSCHEDULER_MAX_BUFFERS);
+
+    scheduler->node        = config->node;
+    scheduler->firstBuffer = config->firstBuffer;
+    scheduler->bufferCount = config->bufferCount;
+    scheduler->frames      = config->frames;
+    scheduler->heap        = config->heap;
+    scheduler->queueSize   = config->queueSize;
+    scheduler->sequence    = 0;
+    scheduler->cancelling  = 0;
+
+    for (i = 0; i < config->queueSize; i++)
+    {
+        scheduler->heap[i] = (uint16)i;
+    }
+
+    for (i = 0; i < config->bufferCount; i++)
+    {
+        IfxCan_TxBufferId bufferId = (IfxCan_TxBufferId)(config->firstBuffer + i);
+        scheduler->state[i] = Ifx_CanTxScheduler_BufferState_free;
+        IfxCan_Node_enableTxBufferTransmissionInterrupt(config->node->node, bufferId);
+        IfxCan_Node_enableTxBufferCancellationFinishedInterrupt(config->node->node, bufferId);
+    }
+
+    scheduler->statistics.queueDepth    = 0;
+    scheduler->statistics.maxQueueDepth = 0;
+    Ifx_CanTxScheduler_resetStatistics(scheduler);
+}
+
+
+boolean Ifx_CanTxScheduler_send(Ifx_CanTxScheduler *scheduler, const IfxCan_Message *message, const uint32 *data)
+{
+    boolean result = FALSE;
+    boolean interruptState;
+
+    interruptState = IfxCpu_disableInterrupts();
+
+    /* the entries reserved for the cancelled frames are not available */
+    if ((scheduler->statistics.queueDepth + scheduler->cancelling) < scheduler->queueSize)
+    {
+        Ifx_CanTxScheduler_Frame *frame  = &scheduler->frames[scheduler->heap[scheduler->statistics.queueDepth]];
+        uint32                    length = __minu(IfxCan_Node_getDataLength(message->dataLengthCode), IFX_CANTXSCHEDULER_MAX_DATA);
+        uint32                    i;
+
+        frame->key        = Ifx_CanTxScheduler_getKey(message->messageId, message->messageIdLength);
+        frame->sequence   = scheduler->sequence++;
+        frame->queuedTime = (uint32)IfxStm_now();
+        frame->message    = *message;
+
+        for (i = 0; i < length; i++)
+        {
+            frame->data[i] = data[i];
+        }
+
+        Ifx_CanTxScheduler_push(scheduler);
+        scheduler->statistics.queued++;
+        Ifx_CanTxScheduler_refill(scheduler);
+        result = TRUE;
+    }
+    else
+    {
+        scheduler->statistics.dropped++;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
+
+
+void Ifx_CanTxScheduler_update(Ifx_CanTxScheduler *scheduler)
+{
+    Ifx_CAN_N *canNode = scheduler->node->node;
+    boolean    interruptState;
+    uint32     pending, occurred, i;
+
+    interruptState = IfxCpu_disableInterrupts();
+
+    /* TO is set when RP is cleared, RP is read first */
+    pending  = canNode->TX.BRP.U;
+    occurred = canNode->TX.BTO.U;
+
+    for (i = 0; i < scheduler->bufferCount; i++)
+    {
+        uint32 mask = 1U << (scheduler->firstBuffer + i);
+
+        if ((scheduler->state[i] != Ifx_CanTxScheduler_BufferState_free) && ((pending & mask) == 0))
+        {
+            Ifx_CanTxScheduler_Frame *frame = &scheduler->buffer[i];
+
+            if (scheduler->state[i] == Ifx_CanTxScheduler_BufferState_cancelling)
+            {   /* the reserved entry is released, or used below if the transmission was cancelled */
+                scheduler->cancelling--;
+            }
+
+            if ((occurred & mask) != 0)
+            {
+                uint32 latency = (uint32)IfxStm_now() - frame->queuedTime; /* wraps around with the lower 32 bit */
+                scheduler->statistics.sent++;
+                scheduler->statistics.latencySum += latency;
+                scheduler->statistics.latencyMax  = __maxu(scheduler->statistics.latencyMax, latency);
+            }
+            else
+            {   /* cancelled, queued again with its original sequence */
+                IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, scheduler->statistics.queueDepth < scheduler->queueSize);
+                scheduler->frames[scheduler->heap[scheduler->statistics.queueDepth]] = *frame;
+                Ifx_CanTxScheduler_push(scheduler);
+            }
+
+            scheduler->state[i] = Ifx_CanTxScheduler_BufferState_free;
+        }
+    }
+
+    Ifx_CanTxScheduler_refill(scheduler);
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void Ifx_CanTxScheduler_getStatistics(Ifx_CanTxScheduler *scheduler, Ifx_CanTxScheduler_Statistics *statistics)
+{
+    boolean interruptState;
+
+    interruptState = IfxCpu_disableInterrupts();
+    *statistics    = scheduler->statistics;
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void Ifx_CanTxScheduler_resetStatistics(Ifx_CanTxScheduler *scheduler)
+{
+    boolean interruptState;
+
+    interruptState = IfxCpu_disableInterrupts();
+    scheduler->statistics.queued        = 0;
+    scheduler->statistics.dropped       = 0;
+    scheduler->statistics.sent          = 0;
+    scheduler->statistics.cancelled     = 0;
+    scheduler->statistics.maxQueueDepth = scheduler->statistics.queueDepth;
+    scheduler->statistics.latencySum    = 0;
+    scheduler->statistics.latencyMax    = 0;
+    IfxCpu_restoreInterrupts(interruptState);
+}
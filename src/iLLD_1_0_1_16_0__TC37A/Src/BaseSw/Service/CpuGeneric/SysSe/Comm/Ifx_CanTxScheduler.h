@@ -0,0 +1,199 @@
+/**
+ * \file Ifx_CanTxScheduler.h
+ * \brief CAN transmit scheduler module header file
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2026-10-17 09:00:00 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_comm_canTxScheduler CAN transmit scheduler
+ * This module queues the messages to be sent on an \ref IfxCan_Can_Node in a software priority queue
+ * ordered by CAN arbitration priority (ID), instead of retrying \ref IfxCan_Can_sendMessage() while
+ * it returns \ref IfxCan_Status_notSentBusy.
+ *
+ * The scheduler owns a range of dedicated Tx buffers, which it refills with the highest priority
+ * messages from the transmission completed interrupt. The M_CAN transmits the pending dedicated
+ * buffers in ID order, so the bus always sees the highest priority messages of the node.
+ * To avoid priority inversion, when all buffers are pending and a message with a higher priority
+ * than one of them is queued, the transmission of the lowest priority buffer is cancelled and its
+ * message is queued again. A queue entry is reserved for the message while the cancellation is
+ * pending, so that an accepted message is never dropped.
+ *
+ * Messages with the same ID are sent in the order of \ref Ifx_CanTxScheduler_send(): only one
+ * message per ID is pending in the hardware. The other messages with this ID wait in the queue
+ * while the next messages with other IDs are loaded into the free buffers.
+ *
+ * \code
+ *     Ifx_CanTxScheduler        scheduler;
+ *     Ifx_CanTxScheduler_Config config;
+ *     Ifx_CanTxScheduler_Frame  frames[32];
+ *     uint16                    heap[32];
+ *
+ *     Ifx_CanTxScheduler_initConfig(&config, &canNode);
+ *     config.firstBuffer = IfxCan_TxBufferId_0;
+ *     config.bufferCount = 4;
+ *     config.frames      = frames;
+ *     config.heap        = heap;
+ *     config.queueSize   = 32;
+ *     Ifx_CanTxScheduler_init(&scheduler, &config);
+ *
+ *     // Tx buffer transmission completed and cancellation finished interrupt:
+ *     Ifx_CanTxScheduler_update(&scheduler);
+ *
+ *     // application:
+ *     Ifx_CanTxScheduler_send(&scheduler, &message, data);
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_comm
+ *
+ */
+#ifndef IFX_CANTXSCHEDULER_H
+#define IFX_CANTXSCHEDULER_H 1
+
+#include "Can/Can/IfxCan_Can.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_CANTXSCHEDULER_MAX_BUFFERS)
+#define IFX_CFG_CANTXSCHEDULER_MAX_BUFFERS (4) /**<\brief Maximum number of dedicated Tx buffers owned by a scheduler */
+#endif
+
+#define IFX_CANTXSCHEDULER_MAX_DATA (16)        /**<\brief Size of the message data in words (64 bytes) */
+
+typedef struct
+{
+    uint32         key;                               /**<\brief Arbitration priority, lower is sent first */
+    uint32         sequence;                          /**<\brief Order of \ref Ifx_CanTxScheduler_send() calls */
+    uint32         queuedTime;                        /**<\brief Time of the \ref Ifx_CanTxScheduler_send() call, lower 32 bit of the system timer */
+    IfxCan_Message message;                           /**<\brief Message */
+    uint32         data[IFX_CANTXSCHEDULER_MAX_DATA]; /**<\brief Message data */
+} Ifx_CanTxScheduler_Frame;
+
+typedef struct
+{
+    uint32 queued;        /**<\brief Number of messages accepted by \ref Ifx_CanTxScheduler_send() */
+    uint32 dropped;       /**<\brief Number of messages rejected because the queue is full */
+    uint32 sent;          /**<\brief Number of messages transmitted, number of samples in latencySum */
+    uint32 cancelled;     /**<\brief Number of cancellation requests issued to avoid a priority inversion */
+    uint16 queueDepth;    /**<\brief Number of messages in the software queue */
+    uint16 maxQueueDepth; /**<\brief Maximum of queueDepth */
+    uint64 latencySum;    /**<\brief Sum of the latencies, from \ref Ifx_CanTxScheduler_send() to the end of transmission, in ticks. Read with \ref Ifx_CanTxScheduler_getStatistics() */
+    uint32 latencyMax;    /**<\brief Maximum latency in ticks, up to 2^32 - 1 */
+} Ifx_CanTxScheduler_Statistics;
+
+typedef struct
+{
+    IfxCan_Can_Node          *node;        /**<\brief CAN Node handle */
+    IfxCan_TxBufferId         firstBuffer; /**<\brief First dedicated Tx buffer owned by the scheduler */
+    uint8                     bufferCount; /**<\brief Number of dedicated Tx buffers, at most \ref IFX_CFG_CANTXSCHEDULER_MAX_BUFFERS */
+    Ifx_CanTxScheduler_Frame *frames;      /**<\brief Queue memory, queueSize frames */
+    uint16                   *heap;        /**<\brief Queue index memory, queueSize entries */
+    uint16                    queueSize;   /**<\brief Size of the queue */
+} Ifx_CanTxScheduler_Config;
+
+typedef enum
+{
+    Ifx_CanTxScheduler_BufferState_free,       /**<\brief The buffer can be written */
+    Ifx_CanTxScheduler_BufferState_pending,    /**<\brief The transmission is requested */
+    Ifx_CanTxScheduler_BufferState_cancelling  /**<\brief The cancellation of the transmission is requested */
+} Ifx_CanTxScheduler_BufferState;
+
+typedef struct
+{
+    IfxCan_Can_Node               *node;                                        /**<\brief CAN Node handle */
+    IfxCan_TxBufferId              firstBuffer;                                 /**<\brief First dedicated Tx buffer owned by the scheduler */
+    uint8                          bufferCount;                                 /**<\brief Number of dedicated Tx buffers */
+    Ifx_CanTxScheduler_Frame      *frames;                                      /**<\brief Queue frames */
+    uint16                        *heap;                                        /**<\brief Indexes of the queued frames, binary heap in [0, queueDepth[, free frames after */
+    uint16                         queueSize;                                   /**<\brief Size of the queue */
+    uint32                         sequence;                                    /**<\brief Sequence of the next message */
+    uint8                          cancelling;                                  /**<\brief Number of buffers with a pending cancellation, each one reserves a queue entry */
+    Ifx_CanTxScheduler_Frame       buffer[IFX_CFG_CANTXSCHEDULER_MAX_BUFFERS];  /**<\brief Copy of the frame in each Tx buffer */
+    Ifx_CanTxScheduler_BufferState state[IFX_CFG_CANTXSCHEDULER_MAX_BUFFERS];   /**<\brief State of each Tx buffer */
+    Ifx_CanTxScheduler_Statistics  statistics;                                  /**<\brief Statistics, statistics.queueDepth is the number of queued frames */
+} Ifx_CanTxScheduler;
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_comm_canTxScheduler
+ * \{ */
+
+/**
+ * \brief Initialize the configuration with default values. Default: Tx buffers 0 to 3, no queue memory.
+ * \param config Pointer to the configuration
+ * \param node CAN Node handle
+ */
+IFX_EXTERN void Ifx_CanTxScheduler_initConfig(Ifx_CanTxScheduler_Config *config, IfxCan_Can_Node *node);
+
+/**
+ * \brief Initialize the scheduler. Enables the transmission completed and cancellation finished interrupts
+ * of the owned Tx buffers, the node interrupt lines are configured by the application.
+ * \param scheduler Pointer to the scheduler object
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_CanTxScheduler_init(Ifx_CanTxScheduler *scheduler, const Ifx_CanTxScheduler_Config *config);
+
+/**
+ * \brief Queue a message. The message is written into a Tx buffer immediately if possible.
+ * May be called from any task or interrupt of the CPU owning the node.
+ * \param scheduler Pointer to the scheduler object
+ * \param message Message, see \ref IfxCan_Can_sendMessage(). bufferNumber and storeInTxFifoQueue are ignored
+ * \param data Message data (in words)
+ * \retval TRUE if the message is queued
+ * \retval FALSE if the queue is full (entries reserved for cancelled messages included), the message is dropped
+ */
+IFX_EXTERN boolean Ifx_CanTxScheduler_send(Ifx_CanTxScheduler *scheduler, const IfxCan_Message *message, const uint32 *data);
+
+/**
+ * \brief Release the completed Tx buffers and refill them from the queue.
+ * To be called from the Tx buffer transmission completed and cancellation finished interrupt.
+ * \param scheduler Pointer to the scheduler object
+ */
+IFX_EXTERN void Ifx_CanTxScheduler_update(Ifx_CanTxScheduler *scheduler);
+
+/**
+ * \brief Copy the statistics with the interrupts disabled, so that the 64 bit latencySum is consistent.
+ * \param scheduler Pointer to the scheduler object
+ * \param statistics Pointer to the copy
+ */
+IFX_EXTERN void Ifx_CanTxScheduler_getStatistics(Ifx_CanTxScheduler *scheduler, Ifx_CanTxScheduler_Statistics *statistics);
+
+/**
+ * \brief Reset the statistics, queueDepth excepted.
+ * \param scheduler Pointer to the scheduler object
+ */
+IFX_EXTERN void Ifx_CanTxScheduler_resetStatistics(Ifx_CanTxScheduler *scheduler);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -46,9 +46,83 @@
 #include "Ifx_Console.h"
 #include "_Utilities/Ifx_Assert.h"
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
+#if IFX_CFG_CONSOLE_DEFERRED
+#include "Cpu/Std/IfxCpu.h"
+#endif
 
 Ifx_Console Ifx_g_console;
 
+#if IFX_CFG_CONSOLE_DEFERRED
+Ifx_Console_DeferredRing Ifx_g_consoleDeferred[IFXCPU_NUM_MODULES];
+
+/** \brief Size of the buffer of one conversion specification in Ifx_Console_formatDeferred(), including the terminating 0 */
+#define IFX_CONSOLE_DEFERRED_SPEC_SIZE (24)
+#endif
+
+/**
+ * \brief Parse the conversion specification starting after '%'.
+ * \param format Pointer on the character following '%'
+ * \param type Returns the argument type
+ * \return Pointer on the character following the conversion specification
+ */
+pchar Ifx_Console_parseConversion(pchar format, Ifx_Console_ArgType *type)
+{
+    uint8 longCount = 0;
+
+    /* flags, width and precision */
+    while (((*format >= '0') && (*format <= '9')) || (*format == '-') || (*format == '+') || (*format == ' ') || (*format == '#') || (*format == '.'))
+    {
+        format++;
+    }
+
+    if (*format == '*')
+    {
+        *type = Ifx_Console_ArgType_invalid;
+        return format;
+    }
+
+    /* length modifiers, "L" (long double) is not supported */
+    while ((*format == 'h') || (*format == 'l') || (*format == 'z') || (*format == 'j') || (*format == 't'))
+    {
+        longCount += (*format == 'l') ? 1 : ((*format == 'j') ? 2 : 0);
+        format++;
+    }
+
+    switch (*format)
+    {
+    case '%':
+        *type = Ifx_Console_ArgType_none;
+        break;
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+    case 'c':
+        *type = (longCount >= 2) ? Ifx_Console_ArgType_int64 : Ifx_Console_ArgType_int32;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+        *type = Ifx_Console_ArgType_double;
+        break;
+    case 's':
+    case 'p':
+        *type = Ifx_Console_ArgType_pointer;
+        break;
+    default:
+        *type = Ifx_Console_ArgType_invalid;
+        return format;
+    }
+
+    return format + 1;
+}
+
+
 /**
  * \brief Initialize the \ref Ifx_g_console object.
  * \param standardIo Pointer to the IfxStdIf_DPipe object used by the \ref Ifx_g_console.
@@ -125,3 +199,242 @@ boolean Ifx_Console_printAlign(pchar format, ...)
         return TRUE;
     }
 }
+
+
+#if IFX_CFG_CONSOLE_DEFERRED
+boolean Ifx_Console_printDeferred(pchar format, ...)
+{
+    Ifx_Console_DeferredRing *ring;
+    Ifx_Console_ArgType       type;
+    uint32                    args[IFX_CFG_CONSOLE_DEFERRED_ARGS];
+    uint32                    count = 0;
+    uint32                    head, i;
+    uint64                    value64;
+    double                    valueDouble;
+    boolean                   interruptState;
+    boolean                   result = TRUE;
+    pchar                     f      = format;
+    pchar                     start;
+    va_list                   ap;
+
+    if (Ifx_g_console.standardIo->txDisabled)
+    {
+        return TRUE;
+    }
+
+    ring = &Ifx_g_consoleDeferred[IfxCpu_getCoreIndex()];
+
+    /* Collect the raw arguments, outside of the critical section */
+    va_start(ap, format);
+
+    while ((*f != 0) && (result != FALSE))
+    {
+        if (*f++ != '%')
+        {
+            continue;
+        }
+
+        start = f - 1;
+        f     = Ifx_Console_parseConversion(f, &type);
+
+        if ((f - start) >= IFX_CONSOLE_DEFERRED_SPEC_SIZE)
+        {
+            type = Ifx_Console_ArgType_invalid; /* Could not be formatted by Ifx_Console_drain() */
+        }
+
+        switch (type)
+        {
+        case Ifx_Console_ArgType_none:
+            break;
+        case Ifx_Console_ArgType_int32:
+        case Ifx_Console_ArgType_pointer:
+
+            if (count < IFX_CFG_CONSOLE_DEFERRED_ARGS)
+            {
+                args[count++] = (type == Ifx_Console_ArgType_int32) ? va_arg(ap, uint32) : (uint32)va_arg(ap, void *);
+            }
+            else
+            {
+                result = FALSE;
+            }
+
+            break;
+        case Ifx_Console_ArgType_int64:
+        case Ifx_Console_ArgType_double:
+
+            if ((count + 2) <= IFX_CFG_CONSOLE_DEFERRED_ARGS)
+            {
+                if (type == Ifx_Console_ArgType_int64)
+                {
+                    value64 = va_arg(ap, uint64);
+                    memcpy(&args[count], &value64, sizeof(value64));
+                }
+                else
+                {
+                    valueDouble = va_arg(ap, double);
+                    memcpy(&args[count], &valueDouble, sizeof(valueDouble));
+                }
+
+                count += 2;
+            }
+            else
+            {
+                result = FALSE;
+            }
+
+            break;
+        default:
+            result = FALSE;
+            break;
+        }
+    }
+
+    va_end(ap);
+
+    if (result == FALSE)
+    {
+        /* The counter is shared with the other tasks and interrupts of the core */
+        interruptState = IfxCpu_disableInterrupts();
+        ring->rejected++;
+        IfxCpu_restoreInterrupts(interruptState);
+        return FALSE;
+    }
+
+    /* Other tasks and interrupts of this core may write the same ring */
+    interruptState = IfxCpu_disableInterrupts();
+    head           = ring->head;
+
+    if ((head - ring->tail) < IFX_CFG_CONSOLE_DEFERRED_RECORDS)
+    {
+        Ifx_Console_DeferredRecord *record = &ring->record[head & (IFX_CFG_CONSOLE_DEFERRED_RECORDS - 1)];
+        record->format = format;
+
+        for (i = 0; i < count; i++)
+        {
+            record->args[i] = args[i];
+        }
+
+        __dsync();              /* record visible before the new head */
+        ring->head = head + 1;
+    }
+    else
+    {
+        ring->dropped++;
+        result = FALSE;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
+
+
+/**
+ * \brief Format a deferred record.
+ * \param message Output buffer of STDIF_DPIPE_MAX_PRINT_SIZE + 1 characters
+ * \param record The record
+ * \return Number of characters written in message, without the terminating 0
+ */
+static Ifx_SizeT Ifx_Console_formatDeferred(char *message, const Ifx_Console_DeferredRecord *record)
+{
+    Ifx_Console_ArgType type;
+    char                spec[IFX_CONSOLE_DEFERRED_SPEC_SIZE];
+    Ifx_SizeT           count = 0;
+    uint32              arg   = 0;
+    sint32              length;
+    uint64              value64;
+    double              valueDouble;
+    pchar               f     = record->format;
+    pchar               start;
+
+    while ((*f != 0) && (count < STDIF_DPIPE_MAX_PRINT_SIZE))
+    {
+        if (*f != '%')
+        {
+            message[count++] = *f++;
+            continue;
+        }
+
+        start = f;
+        f     = Ifx_Console_parseConversion(f + 1, &type);
+
+        if ((type == Ifx_Console_ArgType_invalid) || ((f - start) >= (sint32)sizeof(spec)))
+        {
+            break; /* Not queued by Ifx_Console_printDeferred() */
+        }
+
+        memcpy(spec, start, (size_t)(f - start));
+        spec[f - start] = 0;
+        length          = 0;
+
+        switch (type)
+        {
+        case Ifx_Console_ArgType_none:
+            message[count] = '%';
+            length         = 1;
+            break;
+        case Ifx_Console_ArgType_int32:
+            length = snprintf(&message[count], (size_t)(STDIF_DPIPE_MAX_PRINT_SIZE + 1 - count), spec, record->args[arg]);
+            arg   += 1;
+            break;
+        case Ifx_Console_ArgType_pointer:
+            length = snprintf(&message[count], (size_t)(STDIF_DPIPE_MAX_PRINT_SIZE + 1 - count), spec, (void *)record->args[arg]);
+            arg   += 1;
+            break;
+        case Ifx_Console_ArgType_int64:
+            memcpy(&value64, &record->args[arg], sizeof(value64));
+            length = snprintf(&message[count], (size_t)(STDIF_DPIPE_MAX_PRINT_SIZE + 1 - count), spec, value64);
+            arg   += 2;
+            break;
+        default:
+            memcpy(&valueDouble, &record->args[arg], sizeof(valueDouble));
+            length = snprintf(&message[count], (size_t)(STDIF_DPIPE_MAX_PRINT_SIZE + 1 - count), spec, valueDouble);
+            arg   += 2;
+            break;
+        }
+
+        count = (Ifx_SizeT)__min(count + __max(length, 0), STDIF_DPIPE_MAX_PRINT_SIZE);
+    }
+
+    message[count] = 0;
+
+    return count;
+}
+
+
+boolean Ifx_Console_drain(Ifx_TickTime timeout)
+{
+    char      message[STDIF_DPIPE_MAX_PRINT_SIZE + 1];
+    Ifx_SizeT count;
+    uint32    core;
+
+    for (core = 0; core < IFXCPU_NUM_MODULES; core++)
+    {
+        Ifx_Console_DeferredRing *ring = &Ifx_g_consoleDeferred[core];
+
+        while (ring->tail != ring->head)
+        {
+            __dsync();          /* record read after the head */
+            count = Ifx_Console_formatDeferred(message, &ring->record[ring->tail & (IFX_CFG_CONSOLE_DEFERRED_RECORDS - 1)]);
+
+            /* An empty record is only released, the pipe does not accept a write of 0 characters */
+            if ((count > 0) && !IfxStdIf_DPipe_canWriteCount(Ifx_g_console.standardIo, count, timeout))
+            {
+                return FALSE;   /* record kept for the next call */
+            }
+
+            __dsync();          /* record read before it is released to the writer */
+            ring->tail = ring->tail + 1;
+
+            if (count > 0)
+            {
+                IfxStdIf_DPipe_write(Ifx_g_console.standardIo, (void *)message, &count, timeout);
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+
+#endif
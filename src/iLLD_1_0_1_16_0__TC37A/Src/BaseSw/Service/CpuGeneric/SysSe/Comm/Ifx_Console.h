@@ -52,6 +52,22 @@
 #define IFX_CFG_CONSOLE_INDENT_SIZE (4) /**<\brief Default indentation/alignment size */
 #endif
 
+#if !defined(IFX_CFG_CONSOLE_DEFERRED)
+#define IFX_CFG_CONSOLE_DEFERRED    (0) /**<\brief If 1, \ref Ifx_Console_printDeferred() and \ref Ifx_Console_drain() are available */
+#endif
+
+#if !defined(IFX_CFG_CONSOLE_DEFERRED_RECORDS)
+#define IFX_CFG_CONSOLE_DEFERRED_RECORDS (16) /**<\brief Number of records in each per-core deferred ring, power of 2 */
+#endif
+
+#if !defined(IFX_CFG_CONSOLE_DEFERRED_ARGS)
+#define IFX_CFG_CONSOLE_DEFERRED_ARGS (8) /**<\brief Maximum arguments size of a deferred record, in 32-bit words. 64-bit integers and floating-point arguments use 2 words */
+#endif
+
+#if IFX_CFG_CONSOLE_DEFERRED
+#include "IfxCpu_cfg.h"
+#endif
+
 typedef struct
 {
     IfxStdIf_DPipe *standardIo;       /**<\brief Pointer to the \ref IfxStdIf_DPipe object used as general console */
@@ -60,6 +76,40 @@ typedef struct
 
 IFX_EXTERN Ifx_Console Ifx_g_console; /**< \brief Default main console global variable */
 
+/** \brief Type of the argument of a printf conversion specification, see \ref Ifx_Console_parseConversion() */
+typedef enum
+{
+    Ifx_Console_ArgType_none,      /**<\brief No argument ("%%") */
+    Ifx_Console_ArgType_int32,     /**<\brief int, and smaller types promoted to int */
+    Ifx_Console_ArgType_int64,     /**<\brief long long */
+    Ifx_Console_ArgType_double,    /**<\brief double, and float promoted to double */
+    Ifx_Console_ArgType_pointer,   /**<\brief pointer, "%s" and "%p" */
+    Ifx_Console_ArgType_invalid    /**<\brief Unsupported conversion: "*" width or precision, "L", "%n" */
+} Ifx_Console_ArgType;
+
+#if IFX_CFG_CONSOLE_DEFERRED
+/** \brief Deferred print record: format string and raw arguments */
+typedef struct
+{
+    pchar  format;                              /**<\brief printf-compatible formatted string */
+    uint32 args[IFX_CFG_CONSOLE_DEFERRED_ARGS]; /**<\brief Arguments, in the order of the format string */
+} Ifx_Console_DeferredRecord;
+
+/** \brief Per-core ring of deferred print records
+ *
+ * Written only by the owning core, read only by \ref Ifx_Console_drain(), so no lock is shared between the cores. */
+typedef struct
+{
+    Ifx_Console_DeferredRecord record[IFX_CFG_CONSOLE_DEFERRED_RECORDS]; /**<\brief Records */
+    volatile uint32            head;                                     /**<\brief Number of records written, only modified by the owning core */
+    volatile uint32            tail;                                     /**<\brief Number of records read, only modified by \ref Ifx_Console_drain() */
+    volatile uint32            dropped;                                  /**<\brief Number of records dropped because the ring was full */
+    volatile uint32            rejected;                                 /**<\brief Number of records rejected because of too many or unsupported arguments, or too long conversion specifications */
+} Ifx_Console_DeferredRing;
+
+IFX_EXTERN Ifx_Console_DeferredRing Ifx_g_consoleDeferred[IFXCPU_NUM_MODULES]; /**< \brief Deferred print rings, one per core */
+#endif
+
 //----------------------------------------------------------------------------------------
 /** \addtogroup library_srvsw_sysse_comm_console
  * \{ */
@@ -86,6 +136,43 @@ IFX_EXTERN void    Ifx_Console_init(IfxStdIf_DPipe *standardIo);
 IFX_EXTERN boolean Ifx_Console_print(pchar format, ...);
 IFX_EXTERN boolean Ifx_Console_printAlign(pchar format, ...);
 
+/**
+ * \brief Parse a printf conversion specification, used to store the arguments in binary form.
+ * \param format Pointer on the character following '%'
+ * \param type Returns the argument type
+ * \return Pointer on the character following the conversion specification
+ */
+IFX_EXTERN pchar Ifx_Console_parseConversion(pchar format, Ifx_Console_ArgType *type);
+
+#if IFX_CFG_CONSOLE_DEFERRED
+/**
+ * \brief Queue a formatted string for \ref Ifx_g_console, without formatting nor writing it.
+ *
+ * The format string pointer and the raw arguments are copied into the ring of the calling core,
+ * and formatted later by \ref Ifx_Console_drain(). The cost is bounded by the format string
+ * length and \ref IFX_CFG_CONSOLE_DEFERRED_ARGS, and never depends on the console output.
+ * May be called from any task or interrupt.
+ *
+ * Since the formatting is deferred, the format string and the strings given to "%s" must stay
+ * valid until drained (e.g. string literals). "*" width and precision and "%n" are not supported,
+ * nor conversion specifications longer than 23 characters.
+ * \param format printf-compatible formatted string.
+ * \retval TRUE if the record is queued, or if the console output is disabled
+ * \retval FALSE if the record is dropped, see \ref Ifx_Console_DeferredRing
+ */
+IFX_EXTERN boolean Ifx_Console_printDeferred(pchar format, ...);
+
+/**
+ * \brief Format and write the queued records of all cores into \ref Ifx_g_console.
+ *
+ * To be called periodically from a single low priority task.
+ * \param timeout Maximum time to wait for space in the console output, per record
+ * \retval TRUE if all the rings are empty
+ * \retval FALSE if the console output has no space left
+ */
+IFX_EXTERN boolean Ifx_Console_drain(Ifx_TickTime timeout);
+#endif
+
 /**
  * \brief Decrement the alignment/indentation using the given value
  * \param value the increment. If value == 0, \ref IFX_CFG_CONSOLE_INDENT_SIZE will be used.
@@ -70,13 +70,30 @@
 #define IFX_SHELL_WRITE_BACKSPACES(X) \
     {int ii; for (ii = 0; ii < (X); ii++) {IfxStdIf_DPipe_print(shell->io, "\b"); }}
 
-//---------------------------------------------------------------------------
-char Ifx_Shell_cmdBuffer[IFX_CFG_SHELL_CMD_LINE_SIZE * IFX_CFG_SHELL_CMD_HISTORY_SIZE];
+/* Macro to leave the command history list when the line is edited, so that the next up arrow
+ * searches with the edited text as prefix instead of the prefix of the previous search */
+#if IFX_CFG_SHELL_CMD_HISTORY_PREFIX_SEARCH
+#define IFX_SHELL_CMD_EDITED(cmd) {(cmd)->historyItem = IFX_SHELL_CMD_HISTORY_NO_ITEM; }
+#else
+#define IFX_SHELL_CMD_EDITED(cmd)
+#endif
+
 //---------------------------------------------------------------------------
 void                     Ifx_Shell_execute(Ifx_Shell *shell, pchar commandLine);
 void                     Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeChar2);
 const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar commandLine, pchar *args, Ifx_Shell_CommandListConst *commandList);
 static boolean           Ifx_Shell_matchCommand(pchar *argsPtr, pchar *match);
+static uint32            Ifx_Shell_matchCommandLine(pchar *argsPtr, pchar command);
+static void              Ifx_Shell_processBatch(Ifx_Shell *shell);
+static void              Ifx_Shell_historyAdd(Ifx_Shell_History *history, pchar line, Ifx_SizeT length);
+static boolean           Ifx_Shell_historyMatch(const Ifx_Shell_History *history, Ifx_SizeT item, pchar prefix, Ifx_SizeT prefixLength);
+static Ifx_SizeT         Ifx_Shell_historyFind(const Ifx_Shell_History *history, Ifx_SizeT item, sint32 step, pchar prefix, Ifx_SizeT prefixLength);
+static Ifx_SizeT         Ifx_Shell_historyGet(const Ifx_Shell_History *history, Ifx_SizeT item, char *line);
+static Ifx_Shell_ResultCode Ifx_Shell_executeCommand(Ifx_Shell *shell, pchar commandLine);
+#if IFX_CFG_SHELL_COMMAND_INDEX_SIZE > 0
+static void              Ifx_Shell_commandIndexBuild(Ifx_Shell *shell);
+static const Ifx_Shell_Command *Ifx_Shell_commandIndexFind(Ifx_Shell *shell, uint8 list, pchar commandLine, pchar *args, uint32 *match);
+#endif
 
 //---------------------------------------------------------------------------
 /**
@@ -100,6 +117,27 @@ static boolean Ifx_Shell_writeResult(Ifx_Shell *shell, Ifx_SizeT Code)
 }
 
 
+static boolean Ifx_Shell_writeBatchResult(Ifx_Shell *shell, Ifx_Shell_ResultCode code)
+{
+    uint8     frame[IFX_SHELL_BATCH_RESULT_SIZE];
+    Ifx_SizeT length   = sizeof(frame);
+    uint16    sequence = shell->locals.batchSequence;
+    boolean   result;
+
+    frame[0]                    = IFX_SHELL_BATCH_RESULT_MARKER;
+    frame[1]                    = (uint8)sequence;
+    frame[2]                    = (uint8)(sequence >> 8);
+    frame[3]                    = (uint8)code;
+    shell->locals.batchSequence = sequence + 1;
+
+    result                      = IfxStdIf_DPipe_write(shell->io, frame, &length, TIME_INFINITE);
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, result != FALSE);
+
+    return result;
+}
+
+
 //---------------------------------------------------------------------------
 boolean Ifx_Shell_showHelpSingle(Ifx_Shell_CommandListConst commandList, IfxStdIf_DPipe *io, boolean briefOnly, boolean singleCommand)
 {
@@ -304,6 +342,33 @@ boolean Ifx_Shell_bbProtocolStart(pchar args, void *data, IfxStdIf_DPipe *io)
 }
 
 
+boolean Ifx_Shell_batchMode(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_Shell *shell  = data;
+    boolean    result = TRUE;
+
+    if (Ifx_Shell_matchToken(&args, "?") != FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Syntax     : batch on|off" ENDL);
+        IfxStdIf_DPipe_print(io, "           > enter or leave the batch mode" ENDL);
+    }
+    else if (Ifx_Shell_matchToken(&args, "on") != FALSE)
+    {
+        Ifx_Shell_setBatchMode(shell, TRUE);
+    }
+    else if (Ifx_Shell_matchToken(&args, "off") != FALSE)
+    {
+        Ifx_Shell_setBatchMode(shell, FALSE);
+    }
+    else
+    {
+        result = FALSE;
+    }
+
+    return result;
+}
+
+
 //---------------------------------------------------------------------------
 void Ifx_Shell_initConfig(Ifx_Shell_Config *config)
 {
@@ -323,6 +388,7 @@ void Ifx_Shell_initConfig(Ifx_Shell_Config *config)
     config->protocol.start       = NULL_PTR;
     config->protocol.started     = FALSE;
     config->sendResultCode       = FALSE;
+    config->batch                = FALSE;
     config->showPrompt           = TRUE;
     config->standardIo           = NULL_PTR;
 }
@@ -331,7 +397,6 @@ void Ifx_Shell_initConfig(Ifx_Shell_Config *config)
 boolean Ifx_Shell_init(Ifx_Shell *shell, const Ifx_Shell_Config *config)
 {
     sint32 i;
-    char **CmdHistory = NULL_PTR;   /* Pointer to array of pointers for command history items */
 
     /* Ensure state variable is cleared */
     memset(shell, 0, sizeof(*shell));
@@ -345,6 +410,7 @@ boolean Ifx_Shell_init(Ifx_Shell *shell, const Ifx_Shell_Config *config)
     shell->control.echo           = config->echo;
     shell->control.echoError      = TRUE;
     shell->control.enabled        = TRUE;
+    shell->control.batch          = (config->batch != FALSE);
 
     shell->locals.escBracketNum   = IFX_SHELL_NULL_CHAR; /* Used to cache number in sequence "ESC [ 1/2/3/4 ~" */
     shell->locals.cmdState        = IFX_SHELL_CMD_STATE_NORMAL;
@@ -352,30 +418,22 @@ boolean Ifx_Shell_init(Ifx_Shell *shell, const Ifx_Shell_Config *config)
     /* Copy command line buffer pointer into state variable */
     shell->cmd.cmdStr = shell->locals.cmdStr;
 
-    /* Initialize command history space and cache pointer */
-    memset(Ifx_Shell_cmdBuffer, 0, sizeof(Ifx_Shell_cmdBuffer));
-    shell->cmdHistory[0] = &Ifx_Shell_cmdBuffer[0];
-
     for (i = 0; i < IFX_CFG_SHELL_COMMAND_LISTS; i++)
     {
         shell->commandList[i] = config->commandList[i];
     }
 
-    /* Initialize command history pointers */
-    CmdHistory = shell->cmdHistory;
-
-    for (i = 1; i < IFX_CFG_SHELL_CMD_HISTORY_SIZE; i++)
-    {
-        CmdHistory[i] = &CmdHistory[i - 1][IFX_CFG_SHELL_CMD_LINE_SIZE];    /* Items are just offsets into a large allocated area */
-    }
-
     shell->cmd.historyItem = IFX_SHELL_CMD_HISTORY_NO_ITEM;
 
+#if IFX_CFG_SHELL_COMMAND_INDEX_SIZE > 0
+    Ifx_Shell_commandIndexBuild(shell);
+#endif
+
     /* Pre-load useful commands into history buffer */
-    strcpy(CmdHistory[0], "help");
-    //strcpy(CmdHistory[1], "protocol start");
+    Ifx_Shell_historyAdd(&shell->history, "help", 4);
+    //Ifx_Shell_historyAdd(&shell->history, "protocol start", 14);
 
-    if (shell->control.showPrompt != 0)
+    if ((shell->control.showPrompt != 0) && (shell->control.batch == 0))
     {
         IfxStdIf_DPipe_print(shell->io, ENDL);
         IfxStdIf_DPipe_print(shell->io, IFX_CFG_SHELL_PROMPT);
@@ -395,7 +453,6 @@ void Ifx_Shell_process(Ifx_Shell *shell)
     Ifx_Shell_CmdLine *Cmd         = &shell->cmd;
     char              *inputbuffer = shell->locals.inputbuffer;
     char              *cmdStr      = shell->locals.cmdStr;
-    char             **CmdHistory  = shell->cmdHistory;
 
     if (shell->control.enabled == 0)
     {
@@ -406,6 +463,10 @@ void Ifx_Shell_process(Ifx_Shell *shell)
     {
         shell->protocol.execute(shell->protocol.object);
     }
+    else if (shell->control.batch != 0)
+    {
+        Ifx_Shell_processBatch(shell);
+    }
     else
     {
         /**** NORMAL MODE ****/
@@ -423,12 +484,13 @@ void Ifx_Shell_process(Ifx_Shell *shell)
         /* Backspace ('\b') is also supported.                                          */
         /********************************************************************************/
 
-        count     = 0;
-        readCount = IFX_CFG_SHELL_CMD_LINE_SIZE - count;
+        count                 = shell->locals.pending; /* Characters left by a batch mode change */
+        shell->locals.pending = 0;
+        readCount             = IFX_CFG_SHELL_CMD_LINE_SIZE - count;
         IfxStdIf_DPipe_read(shell->io, &inputbuffer[count], &readCount, TIME_NULL);
-        count    += readCount;
+        count                += readCount;
 
-        for (i = 0; i < count; i++)
+        for (i = 0; (i < count) && (shell->control.batch == 0); i++)
         {
             /* By default, we assume character is part of escape sequence */
             NormalKeyPress = FALSE;
@@ -450,15 +512,7 @@ void Ifx_Shell_process(Ifx_Shell *shell)
 
                     if (Cmd->historyAdd != FALSE)
                     {
-                        /* Shuffle history up */
-                        for (j = IFX_CFG_SHELL_CMD_HISTORY_SIZE - 1; j > 0; j--)
-                        {
-                            /* Copy text */
-                            strncpy(CmdHistory[j], CmdHistory[j - 1], IFX_CFG_SHELL_CMD_LINE_SIZE);
-                        }
-
-                        /* Copy in new entry */
-                        strncpy(CmdHistory[0], cmdStr, IFX_CFG_SHELL_CMD_LINE_SIZE);
+                        Ifx_Shell_historyAdd(&shell->history, cmdStr, Cmd->length);
                     }
 
                     /* Execute command */
@@ -466,7 +520,7 @@ void Ifx_Shell_process(Ifx_Shell *shell)
                 }
 
                 /* Show prompt if in main shell */
-                if (shell->control.showPrompt != 0)
+                if ((shell->control.showPrompt != 0) && (shell->control.batch == 0))
                 {
                     IfxStdIf_DPipe_print(shell->io, IFX_CFG_SHELL_PROMPT);
                 }
@@ -517,6 +571,7 @@ void Ifx_Shell_process(Ifx_Shell *shell)
 
                     /* Command line has been modified */
                     Cmd->historyAdd = TRUE;
+                    IFX_SHELL_CMD_EDITED(Cmd)
                 }
 
                 break;
@@ -619,6 +674,7 @@ void Ifx_Shell_process(Ifx_Shell *shell)
                 {
                     /* Command line has been modified */
                     Cmd->historyAdd = TRUE;
+                    IFX_SHELL_CMD_EDITED(Cmd)
 
                     /* Copy into command line */
                     cmdStr[Cmd->cursor] = inputbuffer[i];
@@ -641,7 +697,235 @@ void Ifx_Shell_process(Ifx_Shell *shell)
                 }
             }
         }
+
+        if (i < count)
+        {
+            /* The command entered the batch mode, keep the remaining characters for it */
+            shell->locals.pending = count - i;
+            memmove(inputbuffer, &inputbuffer[i], (size_t)shell->locals.pending);
+        }
+    }
+}
+
+
+/**
+ * \brief Batch mode processing, see \ref Ifx_Shell_setBatchMode()
+ * \param shell Pointer to the \ref Ifx_Shell object
+ */
+static void Ifx_Shell_processBatch(Ifx_Shell *shell)
+{
+    Ifx_SizeT          i;
+    Ifx_SizeT          count;
+    Ifx_SizeT          readCount;
+    uint32             reads;
+    boolean            full        = TRUE;
+
+    Ifx_Shell_CmdLine *Cmd         = &shell->cmd;
+    char              *inputbuffer = shell->locals.inputbuffer;
+    char              *cmdStr      = shell->locals.cmdStr;
+
+    count                 = shell->locals.pending; /* Characters left by a batch mode change */
+    shell->locals.pending = 0;
+
+    for (reads = 0; (reads < IFX_CFG_SHELL_BATCH_READ_COUNT) && full && (shell->control.batch != 0); reads++)
+    {
+        readCount = IFX_CFG_SHELL_CMD_LINE_SIZE - count;
+        IfxStdIf_DPipe_read(shell->io, &inputbuffer[count], &readCount, TIME_NULL);
+        full      = (readCount == (IFX_CFG_SHELL_CMD_LINE_SIZE - count));
+        count    += readCount;
+
+        for (i = 0; (i < count) && (shell->control.batch != 0); i++)
+        {
+            char c = inputbuffer[i];
+
+            if ((c == '\n') || (c == '\r'))
+            {
+                if (Cmd->length == 0)
+                {
+                    /* Ignore empty lines, and the 2nd character of CR LF */
+                }
+                else if (Cmd->length < IFX_CFG_SHELL_CMD_LINE_SIZE)
+                {
+                    Ifx_Shell_ResultCode code;
+                    cmdStr[Cmd->length] = IFX_SHELL_NULL_CHAR;
+                    Cmd->length         = 0;
+                    code                = Ifx_Shell_executeCommand(shell, cmdStr);
+                    Ifx_Shell_writeBatchResult(shell, code);
+                }
+                else
+                {
+                    /* Line too long, not executed */
+                    Cmd->length = 0;
+                    Ifx_Shell_writeBatchResult(shell, Ifx_Shell_ResultCode_unknown);
+                }
+            }
+            else if (Cmd->length < (IFX_CFG_SHELL_CMD_LINE_SIZE - 1))
+            {
+                cmdStr[Cmd->length] = c;
+                Cmd->length++;
+            }
+            else
+            {
+                /* Line too long - ignore further characters */
+                Cmd->length = IFX_CFG_SHELL_CMD_LINE_SIZE;
+            }
+        }
+
+        if (i < count)
+        {
+            /* The command left the batch mode, keep the remaining characters for the interactive mode */
+            shell->locals.pending = count - i;
+            memmove(inputbuffer, &inputbuffer[i], (size_t)shell->locals.pending);
+        }
+
+        count = 0;
+    }
+}
+
+
+/**
+ * \brief Add a command line as most recent history entry
+ *
+ * The line is ignored if identical to the most recent entry. The oldest entries are dropped until the line fits.
+ * \param history Pointer to the command history
+ * \param line Null-terminated command line
+ * \param length Length of the command line
+ */
+static void Ifx_Shell_historyAdd(Ifx_Shell_History *history, pchar line, Ifx_SizeT length)
+{
+    Ifx_SizeT size = length + 1;
+    Ifx_SizeT chunk;
+
+    if ((length == 0) || (size > IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE))
+    {
+        return;
+    }
+
+    if ((history->count > 0) && (Ifx_Shell_historyMatch(history, 0, line, size) != FALSE))
+    {
+        /* Repeat of the most recent entry, the compared size includes the entry termination */
+        return;
+    }
+
+    /* Drop the oldest entries until the line fits */
+    while ((history->count == IFX_CFG_SHELL_CMD_HISTORY_SIZE) || ((IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE - history->used) < size))
+    {
+        uint16 oldest = (uint16)((history->head + IFX_CFG_SHELL_CMD_HISTORY_SIZE + 1 - history->count) % IFX_CFG_SHELL_CMD_HISTORY_SIZE);
+
+        if (history->count == 1)
+        {
+            history->used = 0;
+        }
+        else
+        {
+            uint16 next = history->entry[(oldest + 1) % IFX_CFG_SHELL_CMD_HISTORY_SIZE];
+            history->used -= (uint16)((next + IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE - history->entry[oldest]) % IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE);
+        }
+
+        history->count--;
+    }
+
+    /* Copy the line, wrapping at the end of the arena */
+    history->head                 = (uint16)((history->head + 1) % IFX_CFG_SHELL_CMD_HISTORY_SIZE);
+    history->entry[history->head] = history->end;
+    chunk                         = __min(length, IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE - history->end);
+    memcpy(&history->arena[history->end], line, (size_t)chunk);
+    memcpy(&history->arena[0], &line[chunk], (size_t)(length - chunk));
+    history->arena[(history->end + length) % IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE] = IFX_SHELL_NULL_CHAR;
+
+    history->end    = (uint16)((history->end + size) % IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE);
+    history->used  += (uint16)size;
+    history->count++;
+}
+
+
+/**
+ * \brief Check whether a history entry starts with a prefix
+ * \param history Pointer to the command history
+ * \param item Entry to check, 0 is the most recent entry
+ * \param prefix Prefix the entry must start with
+ * \param prefixLength Number of characters of the prefix, including the termination for an exact match
+ */
+static boolean Ifx_Shell_historyMatch(const Ifx_Shell_History *history, Ifx_SizeT item, pchar prefix, Ifx_SizeT prefixLength)
+{
+    uint32    offset = history->entry[(history->head + IFX_CFG_SHELL_CMD_HISTORY_SIZE - item) % IFX_CFG_SHELL_CMD_HISTORY_SIZE];
+    Ifx_SizeT i;
+
+    for (i = 0; i < prefixLength; i++)
+    {
+        if (history->arena[offset] != prefix[i])
+        {
+            return FALSE;
+        }
+
+        offset = (offset + 1) % IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE;
+    }
+
+    return TRUE;
+}
+
+
+/**
+ * \brief Search the history for an entry starting with a prefix
+ * \param history Pointer to the command history
+ * \param item First entry to check, 0 is the most recent entry
+ * \param step 1 to search towards older entries, -1 towards more recent entries
+ * \param prefix Prefix the entry must start with
+ * \param prefixLength Number of characters of the prefix
+ * \return The found entry, or IFX_SHELL_CMD_HISTORY_NO_ITEM
+ */
+static Ifx_SizeT Ifx_Shell_historyFind(const Ifx_Shell_History *history, Ifx_SizeT item, sint32 step, pchar prefix, Ifx_SizeT prefixLength)
+{
+    for ( ; (item >= 0) && (item < history->count); item += step)
+    {
+        if (Ifx_Shell_historyMatch(history, item, prefix, prefixLength) != FALSE)
+        {
+            return item;
+        }
     }
+
+    return IFX_SHELL_CMD_HISTORY_NO_ITEM;
+}
+
+
+/**
+ * \brief Copy a history entry
+ * \param history Pointer to the command history
+ * \param item Entry to copy, 0 is the most recent entry
+ * \param line Destination, of IFX_CFG_SHELL_CMD_LINE_SIZE characters
+ * \return The length of the entry
+ */
+static Ifx_SizeT Ifx_Shell_historyGet(const Ifx_Shell_History *history, Ifx_SizeT item, char *line)
+{
+    uint32    offset = history->entry[(history->head + IFX_CFG_SHELL_CMD_HISTORY_SIZE - item) % IFX_CFG_SHELL_CMD_HISTORY_SIZE];
+    Ifx_SizeT length = 0;
+
+    while ((history->arena[offset] != IFX_SHELL_NULL_CHAR) && (length < (IFX_CFG_SHELL_CMD_LINE_SIZE - 1)))
+    {
+        line[length] = history->arena[offset];
+        length++;
+        offset       = (offset + 1) % IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE;
+    }
+
+    line[length] = IFX_SHELL_NULL_CHAR;
+
+    return length;
+}
+
+
+void Ifx_Shell_setBatchMode(Ifx_Shell *shell, boolean enabled)
+{
+    if ((enabled != FALSE) && (shell->control.batch == 0))
+    {
+        shell->locals.batchSequence = 0;
+    }
+
+    shell->control.batch   = (enabled != FALSE);
+    shell->locals.cmdState = IFX_SHELL_CMD_STATE_NORMAL;
+    shell->cmd.length      = 0;
+    shell->cmd.cursor      = 0;
+    shell->cmd.historyAdd  = FALSE;
+    shell->cmd.historyItem = IFX_SHELL_CMD_HISTORY_NO_ITEM;
 }
 
 
@@ -668,13 +952,13 @@ pchar Ifx_Shell_skipWhitespace(pchar args)
 
 boolean Ifx_Shell_matchToken(pchar *argsPtr, pchar token)
 {
-    pchar   savedArguments = *argsPtr;
-    char    buffer[256];
-    boolean result         = FALSE;
+    pchar                savedArguments = *argsPtr;
+    Ifx_Shell_TokenSlice slice;
+    boolean              result         = FALSE;
 
-    if (Ifx_Shell_parseToken(argsPtr, buffer, Ifx_COUNTOF(buffer)) != FALSE)
+    if (Ifx_Shell_parseTokenSlice(argsPtr, &slice) != FALSE)
     {
-        if (strcmp(token, buffer) == 0)
+        if ((strncmp(token, slice.start, slice.length) == 0) && (token[slice.length] == IFX_SHELL_NULL_CHAR))
         {
             result = TRUE;
         }
@@ -694,14 +978,14 @@ static boolean Ifx_Shell_matchCommand(pchar *argsPtr, pchar *match)
 {
     boolean result         = FALSE;
     pchar   savedArguments = *argsPtr;
-    pchar   savedMatch     = *match;
-    char    buffer0[256];
-    char    buffer1[256];
+    pchar                savedMatch     = *match;
+    Ifx_Shell_TokenSlice slice0;
+    Ifx_Shell_TokenSlice slice1;
 
-    if ((Ifx_Shell_parseToken(argsPtr, buffer0, Ifx_COUNTOF(buffer0)) != FALSE)
-        && (Ifx_Shell_parseToken(match, buffer1, Ifx_COUNTOF(buffer1)) != FALSE))
+    if ((Ifx_Shell_parseTokenSlice(argsPtr, &slice0) != FALSE)
+        && (Ifx_Shell_parseTokenSlice(match, &slice1) != FALSE))
     {
-        if (strcmp(buffer1, buffer0) == 0)
+        if ((slice0.length == slice1.length) && (memcmp(slice0.start, slice1.start, (size_t)slice0.length) == 0))
         {
             result = TRUE;
         }
@@ -718,12 +1002,37 @@ static boolean Ifx_Shell_matchCommand(pchar *argsPtr, pchar *match)
 }
 
 
-boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength)
+/**
+ * \brief Match the tokens of a command against the argument string
+ * \param argsPtr Pointer to the argument null-terminated string, moved after the matched tokens
+ * \param command Command string of a \ref Ifx_Shell_Command
+ * \return The number of matched tokens if all tokens of the command matched, else 0
+ */
+static uint32 Ifx_Shell_matchCommandLine(pchar *argsPtr, pchar command)
 {
-    int   mindex = 0;
-    pchar args   = Ifx_Shell_skipWhitespace(*argsPtr);
+    uint32               matchCount = 0;
+    Ifx_Shell_TokenSlice slice;
 
-    tokenBuffer[0] = IFX_SHELL_NULL_CHAR;
+    while (Ifx_Shell_matchCommand(argsPtr, &command) != FALSE)
+    {
+        matchCount++;
+    }
+
+    if ((matchCount != 0) && (Ifx_Shell_parseTokenSlice(&command, &slice) != FALSE))
+    {   /* Command not fully matched */
+        matchCount = 0;
+    }
+
+    return matchCount;
+}
+
+
+boolean Ifx_Shell_parseTokenSlice(pchar *argsPtr, Ifx_Shell_TokenSlice *token)
+{
+    pchar args = Ifx_Shell_skipWhitespace(*argsPtr);
+
+    token->start  = args;
+    token->length = 0;
 
     if (args == NULL_PTR)
     {
@@ -732,16 +1041,11 @@ boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength
 
     if (*args == '\"')
     {
-        args = &args[1];
+        args         = &args[1];
+        token->start = args;
 
         while ((*args != IFX_SHELL_NULL_CHAR) && (*args != '\"'))
         {
-            if (mindex < bufferLength)
-            {
-                tokenBuffer[mindex] = *args;
-                mindex++;
-            }
-
             args = &args[1];
         }
 
@@ -751,7 +1055,8 @@ boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength
             return FALSE;
         }
 
-        args = &args[1];
+        token->length = (Ifx_SizeT)(args - token->start);
+        args          = &args[1];
     }
     else
     {
@@ -763,20 +1068,10 @@ boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength
 
         while ((*args != IFX_SHELL_NULL_CHAR) && (!ISSPACE(*args)))
         {
-            if (mindex < bufferLength)
-            {
-                tokenBuffer[mindex] = *args;
-                mindex++;
-            }
-
             args = &args[1];
         }
-    }
 
-    // make sure string is zero terminated
-    if (bufferLength > 0)
-    {
-        tokenBuffer[__min(mindex, bufferLength - 1)] = IFX_SHELL_NULL_CHAR;
+        token->length = (Ifx_SizeT)(args - token->start);
     }
 
     *argsPtr = Ifx_Shell_skipWhitespace(args);
@@ -785,6 +1080,25 @@ boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength
 }
 
 
+boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength)
+{
+    Ifx_Shell_TokenSlice slice;
+    boolean              result = Ifx_Shell_parseTokenSlice(argsPtr, &slice);
+
+    tokenBuffer[0] = IFX_SHELL_NULL_CHAR;
+
+    // make sure string is zero terminated
+    if ((result != FALSE) && (bufferLength > 0))
+    {
+        Ifx_SizeT length = __min(slice.length, (Ifx_SizeT)(bufferLength - 1));
+        memcpy(tokenBuffer, slice.start, (size_t)length);
+        tokenBuffer[length] = IFX_SHELL_NULL_CHAR;
+    }
+
+    return result;
+}
+
+
 boolean Ifx_Shell_parseAddress(pchar *argsPtr, void **address)
 {
     char    buffer[32];
@@ -957,18 +1271,13 @@ const Ifx_Shell_Command *Ifx_Shell_commandFind(Ifx_Shell_CommandListConst comman
 
     while (command->commandLine != NULL_PTR)
     {
-        pchar  commandTemp     = command->commandLine;
         pchar  commandLineTemp = cmdLineTemp;
-        char   buffer[256];
-        uint32 matchCount      = matchInit;
+        uint32 matchCount      = Ifx_Shell_matchCommandLine(&commandLineTemp, command->commandLine);
 
-        while (Ifx_Shell_matchCommand(&commandLineTemp, &commandTemp) != FALSE)
+        if ((matchCount != 0) && ((matchInit + matchCount) > *match))
         {
-            matchCount++;
-        }
+            matchCount += matchInit;
 
-        if ((matchCount > *match) && (Ifx_Shell_parseToken(&commandTemp, buffer, Ifx_COUNTOF(buffer)) == FALSE))
-        {
             if ((index == 0) && (command->call == NULL_PTR))
             {   /* List has a prefix */
                 cmdLineTemp = commandLineTemp;
@@ -997,6 +1306,168 @@ const Ifx_Shell_Command *Ifx_Shell_commandFind(Ifx_Shell_CommandListConst comman
 }
 
 
+#if IFX_CFG_SHELL_COMMAND_INDEX_SIZE > 0
+/**
+ * \brief Return the index bucket of a command token (FNV-1a over the token and the list index)
+ */
+static uint32 Ifx_Shell_commandIndexBucket(const Ifx_Shell_TokenSlice *token, uint8 list)
+{
+    uint32    hash = 0x811C9DC5UL;
+    Ifx_SizeT i;
+
+    for (i = 0; i < token->length; i++)
+    {
+        hash = (hash ^ (uint8)token->start[i]) * 0x01000193UL;
+    }
+
+    hash = (hash ^ list) * 0x01000193UL;
+
+    return (hash ^ (hash >> 16)) & (IFX_CFG_SHELL_COMMAND_INDEX_BUCKETS - 1);
+}
+
+
+/**
+ * \brief Build the command lookup index from the shell command lists
+ *
+ * Entries are pushed at the head of their bucket, the lists are therefore walked backwards so that
+ * each bucket lists its commands in command table order.
+ * If the commands do not fit into the index, the index is marked invalid and the linear search is used.
+ */
+static void Ifx_Shell_commandIndexBuild(Ifx_Shell *shell)
+{
+    Ifx_Shell_CommandIndex *index = &shell->commandIndex;
+    uint32                  count = 0;
+    sint32                  list;
+    sint32                  i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (IFX_CFG_SHELL_COMMAND_INDEX_BUCKETS & (IFX_CFG_SHELL_COMMAND_INDEX_BUCKETS - 1)) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IFX_CFG_SHELL_COMMAND_INDEX_SIZE < IFX_SHELL_INDEX_END);
+
+    for (i = 0; i < IFX_CFG_SHELL_COMMAND_INDEX_BUCKETS; i++)
+    {
+        index->bucket[i] = IFX_SHELL_INDEX_END;
+    }
+
+    index->valid = TRUE;
+
+    for (list = IFX_CFG_SHELL_COMMAND_LISTS - 1; (list >= 0) && (index->valid != FALSE); list--)
+    {
+        Ifx_Shell_CommandListConst commandList = shell->commandList[list];
+        sint32                     first;
+        sint32                     last;
+
+        index->commandList[list] = commandList;
+
+        if (commandList == NULL_PTR)
+        {
+            continue;
+        }
+
+        /* The list prefix is matched directly by Ifx_Shell_commandIndexFind() */
+        first = ((commandList->commandLine != NULL_PTR) && (commandList->call == NULL_PTR)) ? 1 : 0;
+        last  = first;
+
+        while (commandList[last].commandLine != NULL_PTR)
+        {
+            last++;
+        }
+
+        for (i = last - 1; i >= first; i--)
+        {
+            pchar                commandLine = commandList[i].commandLine;
+            Ifx_Shell_TokenSlice token;
+
+            if (Ifx_Shell_parseTokenSlice(&commandLine, &token) != FALSE)
+            {
+                Ifx_Shell_IndexEntry *entry;
+                uint32                bucket;
+
+                if (count >= IFX_CFG_SHELL_COMMAND_INDEX_SIZE)
+                {
+                    index->valid = FALSE;
+                    break;
+                }
+
+                bucket                = Ifx_Shell_commandIndexBucket(&token, (uint8)list);
+                entry                 = &index->entry[count];
+                entry->command        = &commandList[i];
+                entry->list           = (uint8)list;
+                entry->next           = index->bucket[bucket];
+                index->bucket[bucket] = (uint16)count;
+                count++;
+            }
+        }
+    }
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_WARNING, index->valid != FALSE);
+}
+
+
+/**
+ * \brief Find command in a command list using the lookup index
+ *
+ * Same result as \ref Ifx_Shell_commandFind(), only the commands whose first token matches the command line are evaluated.
+ */
+static const Ifx_Shell_Command *Ifx_Shell_commandIndexFind(Ifx_Shell *shell, uint8 list, pchar commandLine, pchar *args, uint32 *match)
+{
+    const Ifx_Shell_CommandIndex *index       = &shell->commandIndex;
+    Ifx_Shell_CommandListConst    commandList = index->commandList[list];
+    const Ifx_Shell_Command      *result      = NULL_PTR;
+    pchar                         cmdLineTemp = commandLine;
+    pchar                         tokenTemp;
+    uint32                        matchInit   = 0;
+    Ifx_Shell_TokenSlice          token;
+
+    *match = 0;
+
+    if ((commandList->commandLine != NULL_PTR) && (commandList->call == NULL_PTR))
+    {   /* List has a prefix */
+        matchInit = Ifx_Shell_matchCommandLine(&cmdLineTemp, commandList->commandLine);
+
+        if (matchInit == 0)
+        {
+            /* Prefix does not match */
+            return NULL_PTR;
+        }
+
+        *match = matchInit;
+        *args  = cmdLineTemp;
+        result = commandList;
+    }
+
+    tokenTemp = cmdLineTemp;
+
+    if (Ifx_Shell_parseTokenSlice(&tokenTemp, &token) != FALSE)
+    {
+        uint16 entryIndex = index->bucket[Ifx_Shell_commandIndexBucket(&token, list)];
+
+        while (entryIndex != IFX_SHELL_INDEX_END)
+        {
+            const Ifx_Shell_IndexEntry *entry = &index->entry[entryIndex];
+
+            if (entry->list == list)
+            {
+                pchar  commandLineTemp = cmdLineTemp;
+                uint32 matchCount      = Ifx_Shell_matchCommandLine(&commandLineTemp, entry->command->commandLine);
+
+                if ((matchCount != 0) && ((matchInit + matchCount) > *match))
+                {
+                    *match = matchInit + matchCount;
+                    *args  = commandLineTemp;
+                    result = entry->command;
+                }
+            }
+
+            entryIndex = entry->next;
+        }
+    }
+
+    return result;
+}
+
+
+#endif
+
 const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar commandLine, pchar *args, Ifx_Shell_CommandListConst *commandList)
 {
     int                      i;
@@ -1009,7 +1480,17 @@ const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar comma
     {
         if (shell->commandList[i] != NULL_PTR)
         {
-            shellCommand = Ifx_Shell_commandFind(shell->commandList[i], commandLine, args, &match);
+#if IFX_CFG_SHELL_COMMAND_INDEX_SIZE > 0
+
+            if ((shell->commandIndex.valid != FALSE) && (shell->commandIndex.commandList[i] == shell->commandList[i]))
+            {
+                shellCommand = Ifx_Shell_commandIndexFind(shell, (uint8)i, commandLine, args, &match);
+            }
+            else
+#endif
+            {
+                shellCommand = Ifx_Shell_commandFind(shell->commandList[i], commandLine, args, &match);
+            }
 
             if ((shellCommand != NULL_PTR) && (match > matchMax))
             {
@@ -1024,40 +1505,67 @@ const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar comma
 }
 
 
-void Ifx_Shell_execute(Ifx_Shell *shell, pchar commandLine)
+/**
+ * \brief Find and execute a command
+ * \param shell Pointer to the \ref Ifx_Shell object
+ * \param commandLine Null-terminated command line
+ * \return Ifx_Shell_ResultCode_ok or Ifx_Shell_ResultCode_nok as returned by the command call,
+ * Ifx_Shell_ResultCode_undefined if the command has no call (the help is displayed), Ifx_Shell_ResultCode_unknown if no command matches
+ */
+static Ifx_Shell_ResultCode Ifx_Shell_executeCommand(Ifx_Shell *shell, pchar commandLine)
 {
     pchar                      args         = NULL_PTR;
     Ifx_Shell_CommandListConst commandList;
     const Ifx_Shell_Command   *shellCommand = Ifx_Shell_commandListFind(shell, commandLine, &args, &commandList);
+    Ifx_Shell_ResultCode       code;
 
-    if (shellCommand != NULL_PTR)
+    if (shellCommand == NULL_PTR)
     {
-        if (shellCommand->call == NULL_PTR)
+        code = Ifx_Shell_ResultCode_unknown;
+    }
+    else if (shellCommand->call == NULL_PTR)
+    {
+        Ifx_Shell_showHelp(commandLine, shell, shell->io);
+        code = Ifx_Shell_ResultCode_undefined;
+    }
+    else if (shellCommand->call(args, shellCommand->data, shell->io) != FALSE)
+    {
+        code = Ifx_Shell_ResultCode_ok;
+    }
+    else
+    {
+        code = Ifx_Shell_ResultCode_nok;
+    }
+
+    return code;
+}
+
+
+void Ifx_Shell_execute(Ifx_Shell *shell, pchar commandLine)
+{
+    Ifx_Shell_ResultCode code = Ifx_Shell_executeCommand(shell, commandLine);
+
+    if (code == Ifx_Shell_ResultCode_ok)
+    {
+        if (shell->control.sendResultCode != 0)
         {
-            Ifx_Shell_showHelp(commandLine, shell, shell->io);
+            Ifx_Shell_writeResult(shell, Ifx_Shell_ResultCode_ok);
         }
-        else if (shellCommand->call(args, shellCommand->data, shell->io) != FALSE)
+    }
+    else if (code == Ifx_Shell_ResultCode_nok)
+    {
+        if (shell->control.sendResultCode != 0)
         {
-            if (shell->control.sendResultCode != 0)
-            {
-                Ifx_Shell_writeResult(shell, Ifx_Shell_ResultCode_ok);
-            }
+            Ifx_Shell_writeResult(shell, Ifx_Shell_ResultCode_nok);
         }
-        else
+        else if (shell->control.echoError != 0)
         {
-            if (shell->control.sendResultCode != 0)
-            {
-                Ifx_Shell_writeResult(shell, Ifx_Shell_ResultCode_nok);
-            }
-            else if (shell->control.echoError != 0)
-            {
-                IfxStdIf_DPipe_print(shell->io, "\r\nShell command error: %s" ENDL, commandLine);
-            }
-            else
-            {}
+            IfxStdIf_DPipe_print(shell->io, "\r\nShell command error: %s" ENDL, commandLine);
         }
+        else
+        {}
     }
-    else
+    else if (code == Ifx_Shell_ResultCode_unknown)
     {
         if (commandLine[0] != IFX_SHELL_NULL_CHAR)
         {
@@ -1073,6 +1581,8 @@ void Ifx_Shell_execute(Ifx_Shell *shell, pchar commandLine)
             {}
         }
     }
+    else
+    {}
 }
 
 
@@ -1092,6 +1602,7 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
     Ifx_Shell_CmdLine *Cmd    = NULL_PTR; /* Command line editing state */
     char              *cmdStr = NULL_PTR; /* Cached pointer to command line being edited */
     sint32             i      = 0;        /* Loop variable */
+    Ifx_SizeT          item;              /* Command history item */
 
     /* Validate parameters */
     boolean            result = (shell != NULL_PTR);
@@ -1119,72 +1630,76 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
 
         if (Cmd->historyItem == IFX_SHELL_CMD_HISTORY_NO_ITEM)
         {
-            /* Not using list at the moment - take most recent item [0] */
-            Cmd->historyItem = 0;
+            /* Not using list at the moment - search from most recent item [0] */
+#if IFX_CFG_SHELL_CMD_HISTORY_PREFIX_SEARCH
+            Cmd->historyPrefix = Cmd->length; /* Text typed so far is the search prefix */
+#else
+            Cmd->historyPrefix = 0;
+#endif
+            item = Ifx_Shell_historyFind(&shell->history, 0, 1, cmdStr, Cmd->historyPrefix);
         }
         else
         {
-            if (Cmd->historyItem < (IFX_CFG_SHELL_CMD_HISTORY_SIZE - 1))
-            {
-                /* If not already at oldest, go back one in list */
-                Cmd->historyItem++;
-            }
+            /* Go back in list, unless already at oldest */
+            item = Ifx_Shell_historyFind(&shell->history, Cmd->historyItem + 1, 1, cmdStr, Cmd->historyPrefix);
         }
 
-        /* Copy text into buffer */
-        strncpy(cmdStr, shell->cmdHistory[Cmd->historyItem], IFX_CFG_SHELL_CMD_LINE_SIZE);
+        if (item == IFX_SHELL_CMD_HISTORY_NO_ITEM)
+        {
+            break;
+        }
 
         /* echo to screen if requested */
         if (shell->control.echo != 0)
         {
-            IFX_SHELL_WRITE_BACKSPACES(Cmd->cursor)  /* Move cursor back to start */
-            IFX_SHELL_WRITE_SPACES(Cmd->length)      /* Overwrite text with spaces */
-            IFX_SHELL_WRITE_BACKSPACES(Cmd->length)  /* Move cursor back to start */
-            IfxStdIf_DPipe_print(shell->io, cmdStr); /* Copy buffer to screen */
+            IFX_SHELL_WRITE_BACKSPACES(Cmd->cursor) /* Move cursor back to start */
+            IFX_SHELL_WRITE_SPACES(Cmd->length)     /* Overwrite text with spaces */
+            IFX_SHELL_WRITE_BACKSPACES(Cmd->length) /* Move cursor back to start */
         }
 
-        Cmd->cursor     = (Ifx_SizeT)strlen(cmdStr); /* Store cursor position */
-        Cmd->length     = Cmd->cursor;               /* Store command line length */
-        Cmd->historyAdd = FALSE;                     /* Don't add back to history unless modified */
+        /* Copy text into buffer */
+        Cmd->historyItem = item;
+        Cmd->length      = Ifx_Shell_historyGet(&shell->history, item, cmdStr); /* Store command line length */
+        Cmd->cursor      = Cmd->length;                                         /* Store cursor position */
+        Cmd->historyAdd  = FALSE;                                               /* Don't add back to history unless modified */
+        IFX_SHELL_IF_ECHO(IfxStdIf_DPipe_print(shell->io, cmdStr))              /* Copy buffer to screen */
         break;
 
-    case 'B':                                        /* Down arrow */
+    case 'B':                                                                   /* Down arrow */
+
+        item = IFX_SHELL_CMD_HISTORY_NO_ITEM;
 
-        if ((Cmd->historyItem == IFX_SHELL_CMD_HISTORY_NO_ITEM) || (Cmd->historyItem == 0))
+        if (Cmd->historyItem > 0)
         {
-            /* Not using list at the moment, or have dropped off the end - just clear command line */
-            if (shell->control.echo != 0)
-            {
-                IFX_SHELL_WRITE_BACKSPACES(Cmd->cursor)       /* Move cursor back to start */
-                IFX_SHELL_WRITE_SPACES(Cmd->length)           /* Overwrite text with spaces */
-                IFX_SHELL_WRITE_BACKSPACES(Cmd->length)       /* Move cursor back to start */
-            }
+            /* Within list - move to more recent entry */
+            item = Ifx_Shell_historyFind(&shell->history, Cmd->historyItem - 1, -1, cmdStr, Cmd->historyPrefix);
+        }
 
-            Cmd->length      = 0;                             /* Reset command line length */
-            Cmd->cursor      = 0;
-            Cmd->historyItem = IFX_SHELL_CMD_HISTORY_NO_ITEM; /* Ensure we are not using list */
+        if (shell->control.echo != 0)
+        {
+            IFX_SHELL_WRITE_BACKSPACES(Cmd->cursor) /* Move cursor back to start */
+            IFX_SHELL_WRITE_SPACES(Cmd->length)     /* Overwrite text with spaces */
+            IFX_SHELL_WRITE_BACKSPACES(Cmd->length) /* Move cursor back to start */
+        }
+
+        if (item == IFX_SHELL_CMD_HISTORY_NO_ITEM)
+        {
+            /* Not using list at the moment - just clear command line.
+             * Have dropped off the end - back to the search prefix, which all recalled entries start with */
+            Cmd->length         = (Cmd->historyItem == IFX_SHELL_CMD_HISTORY_NO_ITEM) ? 0 : Cmd->historyPrefix;
+            cmdStr[Cmd->length] = IFX_SHELL_NULL_CHAR;
+            Cmd->historyItem    = IFX_SHELL_CMD_HISTORY_NO_ITEM; /* Ensure we are not using list */
         }
         else
         {
-            /* Within list - move to more recent entry */
-            Cmd->historyItem--;
-
             /* Copy text into buffer */
-            strncpy(cmdStr, shell->cmdHistory[Cmd->historyItem], IFX_CFG_SHELL_CMD_LINE_SIZE);
-
-            if (shell->control.echo != 0)
-            {
-                IFX_SHELL_WRITE_BACKSPACES(Cmd->cursor)  /* Move cursor back to start */
-                IFX_SHELL_WRITE_SPACES(Cmd->length)      /* Overwrite text with spaces */
-                IFX_SHELL_WRITE_BACKSPACES(Cmd->length)  /* Move cursor back to start */
-                IfxStdIf_DPipe_print(shell->io, cmdStr); /* Copy buffer to screen */
-            }
-
-            Cmd->cursor = (Ifx_SizeT)strlen(cmdStr);     /* Store cursor position */
-            Cmd->length = Cmd->cursor;                   /* Store command line length */
+            Cmd->historyItem = item;
+            Cmd->length      = Ifx_Shell_historyGet(&shell->history, item, cmdStr);
         }
 
+        Cmd->cursor     = Cmd->length;
         Cmd->historyAdd = FALSE;
+        IFX_SHELL_IF_ECHO(IfxStdIf_DPipe_print(shell->io, cmdStr)) /* Copy buffer to screen */
         break;
 
     case 'C':                  /* Right arrow */
@@ -1255,6 +1770,7 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
                 cmdStr[Cmd->cursor]     = ' ';                 /* Blank character at cursor */
 
                 Cmd->length++;                                 /* Now one character longer */
+                IFX_SHELL_CMD_EDITED(Cmd)
             }
 
             break;
@@ -1284,6 +1800,7 @@ void Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeC
 
                 cmdStr[Cmd->length - 1] = IFX_SHELL_NULL_CHAR; /* Terminate string at end of shorter string */
                 Cmd->length--;                                 /* Now one character shorter */
+                IFX_SHELL_CMD_EDITED(Cmd)
             }
 
             break;
@@ -1308,6 +1825,7 @@ void Ifx_Shell_enable(Ifx_Shell *shell)
 {
     // Clear the Rx buffer!
     IfxStdIf_DPipe_clearRx(shell->io);
+    shell->locals.pending = 0;
     // Enable the shell
     shell->control.enabled = 1;
 }
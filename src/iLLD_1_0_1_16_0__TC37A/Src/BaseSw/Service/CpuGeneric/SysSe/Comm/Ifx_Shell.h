@@ -52,6 +52,8 @@
  * - command short cut is not allowed
  * - command with identical start option "opt1 opt2" and "opt1 opt3" are accepted, and root to different handlers
  * - Enhanced help info print
+ * - Optional hashed command lookup index, see IFX_CFG_SHELL_COMMAND_INDEX_SIZE
+ * - Batch mode for test automation, see \ref Ifx_Shell_setBatchMode()
  *
  * Help text xyntax:
  * - /p indicates a parameter description, can be multi-line, lines must be separated with ENDL
@@ -131,6 +133,14 @@
 #define IFX_CFG_SHELL_CMD_LINE_SIZE    (128)    /**<\brief max command line IFX_CFG_SHELL_CMD_LINE_SIZE - 1 */
 #endif
 
+#ifndef IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE
+#define IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE     (IFX_CFG_SHELL_CMD_HISTORY_SIZE * 32) /**<\brief Size in bytes of the command history storage, the oldest commands are dropped when full. Range IFX_CFG_SHELL_CMD_LINE_SIZE .. 65535 */
+#endif
+
+#ifndef IFX_CFG_SHELL_CMD_HISTORY_PREFIX_SEARCH
+#define IFX_CFG_SHELL_CMD_HISTORY_PREFIX_SEARCH  (0)   /**<\brief If 1, up / down arrows only recall the commands starting with the text typed before the first up arrow */
+#endif
+
 #ifndef IFX_CFG_SHELL_COMMAND_LISTS
 #define IFX_CFG_SHELL_COMMAND_LISTS    (1)      /**<\brief Number of command lists */
 #endif
@@ -139,11 +149,28 @@
 #define IFX_CFG_SHELL_PROMPT           "Shell>"    /**<\brief Shell prompt */
 #endif
 
+#ifndef IFX_CFG_SHELL_BATCH_READ_COUNT
+#define IFX_CFG_SHELL_BATCH_READ_COUNT      (8)     /**<\brief Max number of IFX_CFG_SHELL_CMD_LINE_SIZE reads per Ifx_Shell_process() call in batch mode */
+#endif
+
+#ifndef IFX_CFG_SHELL_COMMAND_INDEX_SIZE
+#define IFX_CFG_SHELL_COMMAND_INDEX_SIZE    (0)     /**<\brief Max number of commands, over all command lists, in the command lookup index. 0 disables the index and commands are searched linearly */
+#endif
+
+#ifndef IFX_CFG_SHELL_COMMAND_INDEX_BUCKETS
+#define IFX_CFG_SHELL_COMMAND_INDEX_BUCKETS (64)    /**<\brief Number of hash buckets in the command lookup index, must be a power of 2 */
+#endif
+
 #define SHELL_HELP_DESCRIPTION_TEXT                      \
     "     : Display command list, and command help."ENDL \
     "/s help: show all commands"ENDL                     \
     "/s help <command>: show the command details"
 
+#define SHELL_BATCH_DESCRIPTION_TEXT                            \
+    "    : Batch mode for test automation."ENDL                \
+    "/s batch on: no echo and prompt, results are framed"ENDL \
+    "/s batch off: back to interactive mode"
+
 /** \brief Marker for end of command list, the end of list is detected by commandLine=NULL */
 #define IFX_SHELL_COMMAND_LIST_END     {0, 0, 0, 0}
 
@@ -152,6 +179,15 @@
 
 /** \brief Signifies no item in use in command history list */
 #define IFX_SHELL_CMD_HISTORY_NO_ITEM  (-1)
+
+/** \brief First byte of a batch mode result frame */
+#define IFX_SHELL_BATCH_RESULT_MARKER  (0x1E)
+
+/** \brief Size in bytes of a batch mode result frame */
+#define IFX_SHELL_BATCH_RESULT_SIZE    (4)
+
+/** \brief Marker for end of a command lookup index bucket */
+#define IFX_SHELL_INDEX_END            (0xFFFFU)
 //----------------------------------------------------------------------------------------
 /** \brief Result code definition used after each executed Shell command */
 typedef enum
@@ -174,6 +210,36 @@ typedef struct
     Ifx_Shell_Call call;
 } Ifx_Shell_Command;
 
+/** \brief Token slice, refers to a token inside the parsed string without copying it */
+typedef struct
+{
+    pchar     start;                /**< \brief Pointer to the first character of the token. For quoted tokens, the character after the opening quote */
+    Ifx_SizeT length;               /**< \brief Number of characters of the token */
+} Ifx_Shell_TokenSlice;
+
+#if IFX_CFG_SHELL_COMMAND_INDEX_SIZE > 0
+/** \brief Command lookup index entry */
+typedef struct
+{
+    const Ifx_Shell_Command *command; /**< \brief Indexed command */
+    uint16                   next;    /**< \brief Next entry in the same bucket, or IFX_SHELL_INDEX_END */
+    uint8                    list;    /**< \brief Index of the command list the command belongs to */
+} Ifx_Shell_IndexEntry;
+
+/** \brief Command lookup index
+ *
+ * The commands are hashed on their first token (the token after the list prefix for lists with a prefix).
+ * A lookup only evaluates the commands of the bucket, in command table order, so the result is identical to the linear search.
+ */
+typedef struct
+{
+    uint16                     bucket[IFX_CFG_SHELL_COMMAND_INDEX_BUCKETS];  /**< \brief First entry of each bucket, or IFX_SHELL_INDEX_END */
+    Ifx_Shell_IndexEntry       entry[IFX_CFG_SHELL_COMMAND_INDEX_SIZE];      /**< \brief Index entries */
+    const Ifx_Shell_Command   *commandList[IFX_CFG_SHELL_COMMAND_LISTS];     /**< \brief Command lists the index was built from */
+    boolean                    valid;                                        /**< \brief FALSE if the commands did not fit into the index */
+} Ifx_Shell_CommandIndex;
+#endif
+
 /** \brief Command line editing state */
 typedef struct
 {
@@ -182,8 +248,24 @@ typedef struct
     Ifx_SizeT length;               /**< \brief Pointer to variable containing total length of command line                                              */
     boolean   historyAdd;           /**< \brief If TRUE, when Enter is pressed, the current cmdLine should be added to the command history (in parent)   */
     Ifx_SizeT historyItem;          /**< \brief Item ID in command history list, or IFX_SHELL_CMD_HISTORY_NO_ITEM if not using list (e.g. new command)       */
+    Ifx_SizeT historyPrefix;        /**< \brief Length of the command line prefix recalled entries must start with, see IFX_CFG_SHELL_CMD_HISTORY_PREFIX_SEARCH */
 } Ifx_Shell_CmdLine;
 
+/** \brief Command history
+ *
+ * The entries are stored null-terminated, one after the other, in a circular byte arena. A ring of arena offsets
+ * locates them, so adding an entry only copies the new command line, and only the oldest entries are dropped.
+ */
+typedef struct
+{
+    char   arena[IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE]; /**< \brief Entry storage, entries wrap at the end of the arena */
+    uint16 entry[IFX_CFG_SHELL_CMD_HISTORY_SIZE];       /**< \brief Arena offset of the entries */
+    uint16 head;                                        /**< \brief Index in entry[] of the most recent entry */
+    uint16 count;                                       /**< \brief Number of entries */
+    uint16 end;                                         /**< \brief Arena offset after the most recent entry */
+    uint16 used;                                        /**< \brief Number of arena bytes used by the entries */
+} Ifx_Shell_History;
+
 /** \brief Shell command processing state */
 typedef enum
 {
@@ -212,6 +294,7 @@ typedef struct
     uint16 sendResultCode : 1;
     uint16 echo : 1;
     uint16 echoError : 1;
+    uint16 batch : 1;
 } Ifx_Shell_Flags;
 
 /** \brief internal Shell run-time data */
@@ -222,6 +305,8 @@ typedef struct
     char               cmdStr[IFX_CFG_SHELL_CMD_LINE_SIZE];
     Ifx_Shell_CmdState cmdState;
     char               escBracketNum;
+    Ifx_SizeT          pending;         /**< \brief Number of received characters left at the start of inputbuffer by a batch mode change */
+    uint16             batchSequence;   /**< \brief Sequence number of the next batch mode result frame */
 } Ifx_Shell_Runtime;
 
 typedef Ifx_Shell_Command       *Ifx_Shell_CommandList;
@@ -235,8 +320,8 @@ typedef struct
 
     Ifx_Shell_Flags control;        /**< \brief control flags */
 
-    /** \brief Array of pointers to the history entries */
-    char *cmdHistory[IFX_CFG_SHELL_CMD_HISTORY_SIZE];
+    /** \brief Command history */
+    Ifx_Shell_History history;
 
     /** \brief Current status of command line editing (saves passing many parameters around) */
     Ifx_Shell_CmdLine cmd;
@@ -253,6 +338,10 @@ typedef struct
     Ifx_Shell_CommandListConst commandList[IFX_CFG_SHELL_COMMAND_LISTS];
 
     Ifx_Shell_Protocol         protocol; /**< \brief Protocol handler data */
+
+#if IFX_CFG_SHELL_COMMAND_INDEX_SIZE > 0
+    Ifx_Shell_CommandIndex commandIndex; /**< \brief Command lookup index, built by \ref Ifx_Shell_init() */
+#endif
 } Ifx_Shell;
 
 /**
@@ -264,6 +353,7 @@ typedef struct
     boolean                    echo;                                     /**<\brief Specifies whether each command shall be echoed back to user */
     boolean                    showPrompt;                               /**<\brief Specifies whether the IFX_CFG_SHELL_PROMPT shall be displayed after each command */
     boolean                    sendResultCode;                           /**<\brief Specifies whether the Ifx_Shell_ResultCode shall be sent to user */
+    boolean                    batch;                                    /**<\brief Specifies whether the Shell starts in batch mode, see \ref Ifx_Shell_setBatchMode() */
     Ifx_Shell_CommandListConst commandList[IFX_CFG_SHELL_COMMAND_LISTS]; /**< \brief Specifies pointer to the command list */
     Ifx_Shell_Protocol         protocol;                                 /**<\brief Configuration for the Ifx_Shell_Protocol */
 } Ifx_Shell_Config;
@@ -277,6 +367,10 @@ typedef struct
     pchar description;                 /**<\brief description */
 } Ifx_Shell_Syntax;
 
+//----------------------------------------------------------------------------------------
+#if (IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE < IFX_CFG_SHELL_CMD_LINE_SIZE) || (IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE > 65535)
+#error IFX_CFG_SHELL_CMD_HISTORY_ARENA_SIZE out of range
+#endif
 //----------------------------------------------------------------------------------------
 /** \addtogroup library_srvsw_sysse_comm_shell
  * \{ */
@@ -325,6 +419,26 @@ IFX_EXTERN void Ifx_Shell_disable(Ifx_Shell *shell);
  */
 IFX_EXTERN void Ifx_Shell_process(Ifx_Shell *shell);
 
+/**
+ * \brief Enter or leave the batch mode.
+ *
+ * In batch mode, \ref Ifx_Shell_process() reads up to IFX_CFG_SHELL_BATCH_READ_COUNT buffers per call and
+ * executes every newline-separated command line in them. Characters are not echoed, no prompt and no error text
+ * are displayed, escape sequences and the history are not processed, and empty lines are ignored.
+ *
+ * After each command line, a result frame of IFX_SHELL_BATCH_RESULT_SIZE bytes is written after the command output:
+ * - byte 0: IFX_SHELL_BATCH_RESULT_MARKER
+ * - byte 1, 2: sequence number, little endian. Starts at 0 when entering batch mode
+ * - byte 3: \ref Ifx_Shell_ResultCode. Ifx_Shell_ResultCode_undefined for a command without call (help is displayed),
+ *   Ifx_Shell_ResultCode_unknown for unknown commands and for lines longer than IFX_CFG_SHELL_CMD_LINE_SIZE - 1
+ *
+ * Characters received after the command line that changes the mode are processed in the new mode.
+ *
+ * \param shell Pointer to the \ref Ifx_Shell object
+ * \param enabled TRUE to enter the batch mode, FALSE to return to the interactive mode
+ */
+IFX_EXTERN void Ifx_Shell_setBatchMode(Ifx_Shell *shell, boolean enabled);
+
 /** \} */
 //----------------------------------------------------------------------------------------
 /** \name Parsing functions
@@ -354,6 +468,16 @@ IFX_EXTERN boolean Ifx_Shell_matchToken(pchar *argsPtr, pchar token);
  */
 IFX_EXTERN boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength);
 
+/**
+ * \brief Parse a token without copying it
+ * Return the next token as a slice of the argument string and move the argsPtr pointer after this token.
+ * The slice is not null-terminated, its characters are the ones \ref Ifx_Shell_parseToken() would copy.
+ * \param argsPtr Pointer to the argument null-terminated string
+ * \param token Pointer to the token slice storage
+ * \retval TRUE if a token was found, else argsPtr is left unchanged
+ */
+IFX_EXTERN boolean Ifx_Shell_parseTokenSlice(pchar *argsPtr, Ifx_Shell_TokenSlice *token);
+
 /**
  * \brief Parse an address
  * \param argsPtr Pointer to the argument null-terminated string
@@ -412,6 +536,9 @@ IFX_EXTERN boolean Ifx_Shell_parseFloat32(pchar *argsPtr, float32 *value);
 
 /**
  * \brief Find command in command List
+ *
+ * This is the linear search over a single list. \ref Ifx_Shell_init() builds a hashed index over the
+ * configured command lists when IFX_CFG_SHELL_COMMAND_INDEX_SIZE is not 0, and the shell uses it instead.
  * \param commandList Pointer to the first entry of an array of \ref Ifx_Shell_Command
  * \param commandLine Pointer to null-terminated string containings the command to search.
  * \param args Pointer to the argument null-terminated string
@@ -443,6 +570,18 @@ IFX_EXTERN boolean Ifx_Shell_showHelp(pchar args, void *shellPtr, IfxStdIf_DPipe
  */
 IFX_EXTERN void Ifx_Shell_printSyntax(const Ifx_Shell_Syntax *syntaxList, IfxStdIf_DPipe *io);
 
+/**
+ * \brief Implementation of \ref Ifx_Shell_Call. Enter or leave the batch mode, see \ref Ifx_Shell_setBatchMode().
+ *
+ * Register with SHELL_BATCH_DESCRIPTION_TEXT:
+ *    {"batch",        SHELL_BATCH_DESCRIPTION_TEXT                            , &\<Ifx_Shell\>, &Ifx_Shell_batchMode,       },
+ *
+ * \param args The argument null-terminated string
+ * \param data Pointer to \ref Ifx_Shell object
+ * \param io Pointer to \ref IfxStdIf_DPipe object
+ */
+IFX_EXTERN boolean Ifx_Shell_batchMode(pchar args, void *data, IfxStdIf_DPipe *io);
+
 /** \} */
 //----------------------------------------------------------------------------------------
 /** \name Sub protocol functions
@@ -0,0 +1,278 @@
+/**
+ * \file Ifx_Trace.c
+ * \brief Binary trace module implementation file
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2026-10-17 09:00:00 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <string.h>
+#include <stdarg.h>
+
+#include "Ifx_Trace.h"
+#include "Ifx_Console.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Stm/Std/IfxStm.h"
+
+/** \brief Maximum size of a varint */
+#define IFX_TRACE_VARINT_MAX_SIZE (10)
+
+/**
+ * \brief Append an unsigned integer in varint encoding (7 bits per byte, LSB first, bit 7 set if more bytes follow).
+ * \return Index following the varint
+ */
+static uint32 Ifx_Trace_putVarint(uint8 *buffer, uint32 index, uint64 value)
+{
+    while (value >= 0x80)
+    {
+        buffer[index++]   = (uint8)(value | 0x80);
+        value           >>= 7;
+    }
+
+    buffer[index++] = (uint8)value;
+
+    return index;
+}
+
+
+/**
+ * \brief COBS encoding of the record, with the trailing 0x00 delimiter.
+ * frame shall have space for length + length / 254 + 2 bytes.
+ * \return Frame size
+ */
+static Ifx_SizeT Ifx_Trace_encodeCobs(uint8 *frame, const uint8 *data, uint32 length)
+{
+    uint32 code = 0; /* index of the current code byte */
+    uint32 out  = 1;
+    uint8  run  = 1;
+    uint32 i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (data[i] == 0)
+        {
+            frame[code] = run;
+            code        = out++;
+            run         = 1;
+        }
+        else
+        {
+            frame[out++] = data[i];
+            run++;
+
+            if (run == 0xFF)
+            {
+                frame[code] = run;
+                code        = out++;
+                run         = 1;
+            }
+        }
+    }
+
+    frame[code]  = run;
+    frame[out++] = 0;
+
+    return (Ifx_SizeT)out;
+}
+
+
+void Ifx_Trace_init(Ifx_Trace *trace, IfxStdIf_DPipe *io, Ifc_Crc *crc)
+{
+    /* Ifx_Crc_tableFast() processes whole bytes, other orders would give wrong frames */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (crc->table->order % 8) == 0);
+
+    trace->io            = io;
+    trace->crc           = crc;
+    trace->lastTimestamp = 0;
+    trace->syncCount     = 0;
+    trace->sent          = 0;
+    trace->dropped       = 0;
+    trace->rejected      = 0;
+}
+
+
+boolean Ifx_Trace_print(Ifx_Trace *trace, pchar format, ...)
+{
+    uint8               args[IFX_CFG_TRACE_MAX_RECORD_SIZE];
+    uint8               record[IFX_CFG_TRACE_MAX_RECORD_SIZE];
+    uint8               frame[sizeof(record) + (sizeof(record) / 254) + 2];
+    uint32              crcSize  = ((uint32)trace->crc->table->order + 7) / 8;
+    uint32              argsSize = 0;
+    uint32              maxSize;
+    uint32              index, i, crc, length;
+    Ifx_Console_ArgType type;
+    Ifx_TickTime        now;
+    Ifx_SizeT           count;
+    boolean             interruptState;
+    boolean             absolute;
+    boolean             result   = TRUE;
+    pchar               f        = format;
+    va_list             ap;
+
+    /* Room left for the header and timestamp: 5 bytes for a 32-bit address, 10 bytes for a timestamp */
+    maxSize = IFX_CFG_TRACE_MAX_RECORD_SIZE - crcSize - 5 - IFX_TRACE_VARINT_MAX_SIZE;
+
+    /* Encode the arguments, outside of the critical section */
+    va_start(ap, format);
+
+    while (*f != 0)
+    {
+        uint8  encoded[IFX_TRACE_VARINT_MAX_SIZE + 8];
+        uint32 size = 0;
+
+        if (*f++ != '%')
+        {
+            continue;
+        }
+
+        f = Ifx_Console_parseConversion(f, &type);
+
+        if (type == Ifx_Console_ArgType_invalid)
+        {
+            result = FALSE;
+            break;
+        }
+        else if (type == Ifx_Console_ArgType_int32)
+        {
+            if ((f[-1] == 'd') || (f[-1] == 'i'))
+            {
+                sint32 value = va_arg(ap, sint32);
+                size = Ifx_Trace_putVarint(encoded, 0, ((uint32)value << 1) ^ (uint32)(value >> 31));
+            }
+            else
+            {
+                size = Ifx_Trace_putVarint(encoded, 0, va_arg(ap, uint32));
+            }
+        }
+        else if (type == Ifx_Console_ArgType_int64)
+        {
+            if ((f[-1] == 'd') || (f[-1] == 'i'))
+            {
+                sint64 value = va_arg(ap, sint64);
+                size = Ifx_Trace_putVarint(encoded, 0, ((uint64)value << 1) ^ (uint64)(value >> 63));
+            }
+            else
+            {
+                size = Ifx_Trace_putVarint(encoded, 0, va_arg(ap, uint64));
+            }
+        }
+        else if (type == Ifx_Console_ArgType_double)
+        {
+            double value = va_arg(ap, double);
+            memcpy(encoded, &value, sizeof(value));
+            size = sizeof(value);
+        }
+        else if (type == Ifx_Console_ArgType_pointer)
+        {
+            void *value = va_arg(ap, void *);
+
+            if (f[-1] == 's')
+            {
+                /* The string itself is sent, it may not be part of the ELF file */
+                length = (uint32)strlen((const char *)value);
+
+                if ((argsSize + 1) >= maxSize)
+                {
+                    break; /* truncated */
+                }
+
+                length           = __minu(length, __minu(maxSize - argsSize - 1, 0x7F));
+                args[argsSize++] = (uint8)length;
+                memcpy(&args[argsSize], value, length);
+                argsSize        += length;
+                continue;
+            }
+
+            size = Ifx_Trace_putVarint(encoded, 0, (uint32)value);
+        }
+
+        if ((argsSize + size) > maxSize)
+        {
+            break; /* truncated */
+        }
+
+        memcpy(&args[argsSize], encoded, size);
+        argsSize += size;
+    }
+
+    va_end(ap);
+
+    if (result == FALSE)
+    {
+        /* The counter is shared with the other tasks and interrupts of the core */
+        interruptState = IfxCpu_disableInterrupts();
+        trace->rejected++;
+        IfxCpu_restoreInterrupts(interruptState);
+        return FALSE;
+    }
+
+    /* Timestamp, framing and output are done atomically, so that the records and their time stamps stay in order */
+    interruptState = IfxCpu_disableInterrupts();
+
+    now      = IfxStm_now();
+    absolute = (trace->syncCount == 0) ? TRUE : FALSE;
+    index    = Ifx_Trace_putVarint(record, 0, ((uint64)(uint32)format << 1) | (absolute ? 1 : 0));
+    index    = Ifx_Trace_putVarint(record, index, (uint64)(absolute ? now : (now - trace->lastTimestamp)));
+    memcpy(&record[index], args, argsSize);
+    index   += argsSize;
+    crc      = Ifx_Crc_tableFast(trace->crc, record, index);
+
+    for (i = 0; i < crcSize; i++)
+    {
+        record[index++]   = (uint8)crc;
+        crc             >>= 8;
+    }
+
+    count = Ifx_Trace_encodeCobs(frame, record, index);
+
+    if (IfxStdIf_DPipe_canWriteCount(trace->io, count, TIME_NULL))
+    {
+        IfxStdIf_DPipe_write(trace->io, frame, &count, TIME_NULL);
+        trace->lastTimestamp = now;
+        trace->syncCount     = (absolute ? IFX_CFG_TRACE_SYNC_PERIOD : trace->syncCount) - 1;
+        trace->sent++;
+    }
+    else
+    {
+        trace->dropped++;
+        result = FALSE;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
@@ -0,0 +1,121 @@
+/**
+ * \file Ifx_Trace.h
+ * \brief Binary trace module header file
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2026-10-17 09:00:00 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_comm_trace Binary trace
+ * This module implements a compact binary alternative to \ref Ifx_Console_print(), carried on
+ * any \ref IfxStdIf_DPipe (ASCLIN, QSPI, GETH, ...).
+ *
+ * Instead of the formatted text, each record holds the address of the format string,
+ * an \ref IfxStm_now() timestamp and the raw arguments. The text is rebuilt on the host
+ * by looking up the format string at that address in the application ELF file.
+ *
+ * Frame: COBS(record), followed by a 0x00 delimiter.\n
+ * Record, all multi-byte fields little endian:
+ * - header: varint, (format string address << 1) | 1 if the timestamp is absolute
+ * - timestamp: varint, absolute STM ticks, or ticks since the previous record of the same \ref Ifx_Trace
+ * - arguments, in the order of the format string:
+ *   - d, i: zigzag varint (signed)
+ *   - other integer conversions and %p: varint
+ *   - floating-point conversions: 8 bytes IEEE 754 double
+ *   - %s: varint length, followed by the characters (at most 127, truncated to fit the record)
+ * - CRC computed with the \ref Ifc_Crc driver over the record, on (order + 7) / 8 bytes
+ *
+ * An absolute timestamp is sent with the first record and then every \ref IFX_CFG_TRACE_SYNC_PERIOD
+ * records, so that the host recovers the time base after a lost frame.
+ *
+ * \ingroup library_srvsw_sysse_comm
+ *
+ */
+#ifndef IFX_TRACE_H
+#define IFX_TRACE_H 1
+
+#include "StdIf/IfxStdIf_DPipe.h"
+#include "SysSe/Math/Ifx_Crc.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_TRACE_MAX_RECORD_SIZE)
+#define IFX_CFG_TRACE_MAX_RECORD_SIZE (64) /**<\brief Maximum size of a record in bytes, before the COBS framing */
+#endif
+
+#if !defined(IFX_CFG_TRACE_SYNC_PERIOD)
+#define IFX_CFG_TRACE_SYNC_PERIOD     (32) /**<\brief Maximum number of records between two absolute timestamps */
+#endif
+
+typedef struct
+{
+    IfxStdIf_DPipe *io;                 /**<\brief Pointer to the \ref IfxStdIf_DPipe object used for the output */
+    Ifc_Crc        *crc;                /**<\brief Pointer to the CRC driver used for the record CRC */
+    Ifx_TickTime    lastTimestamp;      /**<\brief Timestamp of the last record sent */
+    uint32          syncCount;          /**<\brief Number of records to send before the next absolute timestamp */
+    uint32          sent;               /**<\brief Number of records sent */
+    uint32          dropped;            /**<\brief Number of records dropped because the output had no space */
+    uint32          rejected;           /**<\brief Number of records rejected because of unsupported conversions */
+} Ifx_Trace;
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_comm_trace
+ * \{ */
+
+/**
+ * \brief Initialize the trace object.
+ * \param trace Pointer to the trace object
+ * \param io Pointer to the \ref IfxStdIf_DPipe object used for the output
+ * \param crc Pointer to an initialised CRC driver of order 8, 16, 24 or 32, e.g. CRC-16/CCITT
+ */
+IFX_EXTERN void Ifx_Trace_init(Ifx_Trace *trace, IfxStdIf_DPipe *io, Ifc_Crc *crc);
+
+/**
+ * \brief Send a binary trace record.
+ *
+ * Never waits: if the output has not enough space, the record is dropped and counted.
+ * The format string shall be located in memory which is part of the ELF file (e.g. a string literal).
+ * Records which do not fit \ref IFX_CFG_TRACE_MAX_RECORD_SIZE are truncated: the arguments which do not fit are
+ * left out, except a %s string which is cut to the space left, so the last argument of the record may be a partial string.
+ * May be called from any task or interrupt of the core, the record is written with the interrupts disabled.
+ * \param trace Pointer to the trace object
+ * \param format printf-compatible formatted string, see \ref Ifx_Console_parseConversion() for the restrictions
+ * \retval TRUE if the record is sent
+ * \retval FALSE if the record is dropped or rejected
+ */
+IFX_EXTERN boolean Ifx_Trace_print(Ifx_Trace *trace, pchar format, ...);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
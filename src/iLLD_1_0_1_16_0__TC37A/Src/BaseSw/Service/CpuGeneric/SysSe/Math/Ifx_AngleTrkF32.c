@@ -47,6 +47,7 @@
 #include <math.h>
 #include "string.h"
 #include "Ifx_LutAtan2F32.h"
+#include "_Utilities/Ifx_Assert.h"
 
 //________________________________________________________________________________________
 // LOCAL DEFINITIONS
@@ -264,6 +265,110 @@ float32 Ifx_AngleTrkF32_step(Ifx_AngleTrkF32 *aObsv, sint16 sinIn, sint16 cosIn,
 }
 
 
+/** \brief Initialize the multi-channel Angle Tracking object
+ * \param multi Pointer to the Ifx_AngleTrkF32_Multi object
+ * \param config Array of channelCount configurations, one per channel
+ * \param channelCount Number of channels, at most IFX_CFG_ANGLETRKF32_MAX_CHANNELS
+ * \param Ts sampling period in seconds, common to all channels
+ * \note The channel parameters are derived by Ifx_AngleTrkF32_init(), so that each channel behaves exactly as a
+ * single Ifx_AngleTrkF32 object initialised with the same configuration.
+ */
+void Ifx_AngleTrkF32_initMulti(Ifx_AngleTrkF32_Multi *multi, const Ifx_AngleTrkF32_Config *config, uint8 channelCount, float32 Ts)
+{
+    Ifx_AngleTrkF32 channel;
+    uint8           i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, channelCount <= IFX_CFG_ANGLETRKF32_MAX_CHANNELS);
+
+    memset(multi, 0, sizeof(*multi));
+    multi->channelCount = channelCount;
+
+    for (i = 0; i < channelCount; i++)
+    {
+        Ifx_AngleTrkF32_init(&channel, &config[i], Ts);
+        multi->reversed[i] = channel.base.reversed;
+        multi->kp[i]       = channel.cfgData.kp;
+        multi->ki[i]       = channel.cfgData.ki;
+        multi->kd[i]       = channel.cfgData.kd;
+#if IFX_CFG_ANGLETRKF32_SPEED_FILTER
+        multi->speedLpfA[i] = channel.speedLpf.a;
+        multi->speedLpfB[i] = channel.speedLpf.b;
+#endif
+        multi->Ts     = channel.base.Ts;
+        multi->halfTs = channel.halfTs;
+    }
+}
+
+
+/** \brief Step function of Ifx_AngleTrkF32_Multi, updates all channels for one sampling period
+ *
+ * The channels are processed stage by stage: first the arctangent of all channels, then the observer loop of all
+ * channels. The observer loop is branch free and has no call, so it can be software pipelined over the channels.
+ * The arithmetic of each channel is the same, in the same order, as Ifx_AngleTrkF32_step(), the results are
+ * identical to channelCount independent Ifx_AngleTrkF32 objects.
+ *
+ * \param multi Pointer to the Ifx_AngleTrkF32_Multi object
+ * \param sinIn sine input signals, one per channel. The offset shall be zero.
+ * \param cosIn cosine input signals, one per channel. The offset shall be zero.
+ * \param phase phase of input signals, one per channel. NULL_PTR for zero phase.
+ * \param angleEst Output: angular position in radians, one per channel. May be NULL_PTR.
+ */
+void Ifx_AngleTrkF32_stepN(Ifx_AngleTrkF32_Multi *multi, const sint16 *sinIn, const sint16 *cosIn, const float32 *phase, float32 *angleEst)
+{
+    uint8   i;
+    uint8   count      = multi->channelCount;
+    float32 Ts         = multi->Ts;
+    float32 halfTs     = multi->halfTs;
+    float32 fullPeriod = 2 * IFX_PI;
+
+    for (i = 0; i < count; i++)
+    {
+        float32 y = (float32)sinIn[i];
+        float32 x = (float32)cosIn[i];
+        float32 angleAtan;
+
+        angleAtan           = multi->reversed[i] != FALSE ? IFX_ANGLETRKF32_ATAN2F(x, y) : IFX_ANGLETRKF32_ATAN2F(y, x);
+        multi->angleAtan[i] = angleAtan;
+        multi->angleRef[i]  = angleAtan + (phase != NULL_PTR ? phase[i] : 0.0F);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        float32 angleErr = multi->angleErr[i];
+        float32 accelEst, speedEstA, dAngle, angle;
+
+        accelEst  = multi->accelEst[i] + ((multi->ki[i] * angleErr) * Ts);
+        speedEstA = multi->speedEstA[i] + (((multi->kp[i] * angleErr) + accelEst) * Ts);
+        dAngle    = (multi->kd[i] * angleErr) + speedEstA;
+        angle     = multi->angleEst[i] + ((dAngle + multi->speedEstB[i]) * halfTs);
+
+        /* Same as Ifx_AngleTrkF32_boundInput(), written as selects */
+        angle    = angle >= (fullPeriod / 2) ? angle - fullPeriod : angle;
+        angle    = angle < (-fullPeriod / 2) ? angle + fullPeriod : angle;
+        angleErr = multi->angleRef[i] - angle;
+        angleErr = angleErr >= (fullPeriod / 2) ? angleErr - fullPeriod : angleErr;
+        angleErr = angleErr < (-fullPeriod / 2) ? angleErr + fullPeriod : angleErr;
+
+        multi->accelEst[i]  = accelEst;
+        multi->speedEstA[i] = speedEstA;
+        multi->speedEstB[i] = dAngle;
+        multi->angleEst[i]  = angle;
+        multi->angleErr[i]  = angleErr;
+#if IFX_CFG_ANGLETRKF32_SPEED_FILTER
+        multi->speedLpfOut[i] = multi->speedLpfOut[i] + multi->speedLpfA[i] * dAngle - multi->speedLpfB[i] * multi->speedLpfOut[i];
+#endif
+    }
+
+    if (angleEst != NULL_PTR)
+    {
+        for (i = 0; i < count; i++)
+        {
+            angleEst[i] = multi->angleEst[i];
+        }
+    }
+}
+
+
 /** \brief Set the position offset (in ticks)
  * \param aObsv Pointer to the Ifx_AngleTrkF32 object
  * \param offset Position offset in ticks 
@@ -66,6 +66,11 @@
 #define IFX_CFG_ANGLETRKF32_FILTERED_SPEED (1)
 #endif
 
+/** \brief Maximum number of channels of \ref Ifx_AngleTrkF32_Multi */
+#ifndef IFX_CFG_ANGLETRKF32_MAX_CHANNELS
+#define IFX_CFG_ANGLETRKF32_MAX_CHANNELS (8)
+#endif
+
 //________________________________________________________________________________________
 // DATA STRUCTURES
 
@@ -130,6 +135,35 @@ typedef struct
     Ifx_LowPassPt1F32       speedLpf; /**< Only used if IFX_CFG_ANGLETRKF32_SPEED_FILTER is set */
 } Ifx_AngleTrkF32;
 
+/** \brief Multi-channel Angle Tracking Observer object
+ *
+ * Structure of arrays, indexed by channel: each variable of all channels is contiguous, and
+ * Ifx_AngleTrkF32_stepN() updates all channels in one pass over each variable.
+ * The channels share the sampling period.
+ */
+typedef struct
+{
+    uint8   channelCount;                                  /**< \brief Number of channels */
+    float32 Ts;                                            /**< \brief update period in seconds */
+    float32 halfTs;
+    /* configuration */
+    boolean reversed[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];    /**< \brief reverse direction */
+    float32 kp[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];          /**< \brief Proportional gain */
+    float32 ki[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];          /**< \brief Integrator gain */
+    float32 kd[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];          /**< \brief Derivative gain */
+    float32 speedLpfA[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];   /**< \brief Speed low-pass filter a parameter */
+    float32 speedLpfB[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];   /**< \brief Speed low-pass filter b parameter */
+    /* state */
+    float32 angleAtan[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];
+    float32 angleRef[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];
+    float32 angleEst[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];
+    float32 angleErr[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];
+    float32 speedEstA[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];
+    float32 speedEstB[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];
+    float32 accelEst[IFX_CFG_ANGLETRKF32_MAX_CHANNELS];
+    float32 speedLpfOut[IFX_CFG_ANGLETRKF32_MAX_CHANNELS]; /**< \brief Filtered speed. Only used if IFX_CFG_ANGLETRKF32_SPEED_FILTER is set */
+} Ifx_AngleTrkF32_Multi;
+
 /** \addtogroup library_srvsw_sysse_math_f32_angletrk
  * \{ */
 
@@ -167,6 +201,28 @@ IFX_EXTERN void    Ifx_AngleTrkF32_updateStatus(Ifx_AngleTrkF32 *aObsv, sint16 s
 IFX_INLINE float32 Ifx_AngleTrkF32_getLoopSpeed(Ifx_AngleTrkF32 *aObsv);
 /** \} */
 
+/** \name Multi-channel functions
+ * Example use, 6 resolver channels:
+ * \code
+ * Ifx_AngleTrkF32_Config config[6];
+ * Ifx_AngleTrkF32_Multi  trackers;
+ * sint16                 sinIn[6], cosIn[6];
+ * float32                angle[6];
+ * for (i = 0; i < 6; i++)
+ * {
+ *     Ifx_AngleTrkF32_initConfig(&config[i], NULL_PTR, NULL_PTR);
+ * }
+ * Ifx_AngleTrkF32_initMulti(&trackers, config, 6, 50e-6);
+ * // every period:
+ * Ifx_AngleTrkF32_stepN(&trackers, sinIn, cosIn, NULL_PTR, angle);
+ * \endcode
+ * Prototypes:
+ * \{ */
+IFX_EXTERN void    Ifx_AngleTrkF32_initMulti(Ifx_AngleTrkF32_Multi *multi, const Ifx_AngleTrkF32_Config *config, uint8 channelCount, float32 Ts);
+IFX_EXTERN void    Ifx_AngleTrkF32_stepN(Ifx_AngleTrkF32_Multi *multi, const sint16 *sinIn, const sint16 *cosIn, const float32 *phase, float32 *angleEst);
+IFX_INLINE float32 Ifx_AngleTrkF32_getMultiSpeed(const Ifx_AngleTrkF32_Multi *multi, uint8 channel);
+/** \} */
+
 /** \} */
 
 /** \brief get the speed.
@@ -179,6 +235,20 @@ IFX_INLINE float32 Ifx_AngleTrkF32_getLoopSpeed(Ifx_AngleTrkF32 *aObsv)
 }
 
 
+/** \brief Returns the speed of a channel, see Ifx_AngleTrkF32_getSpeed()
+ * \param multi Pointer to the Ifx_AngleTrkF32_Multi object
+ * \param channel Channel index
+ */
+IFX_INLINE float32 Ifx_AngleTrkF32_getMultiSpeed(const Ifx_AngleTrkF32_Multi *multi, uint8 channel)
+{
+#if !IFX_CFG_ANGLETRKF32_FILTERED_SPEED
+    return multi->speedEstB[channel];
+#else
+    return multi->speedLpfOut[channel];
+#endif
+}
+
+
 /** \addtogroup library_srvsw_sysse_math_f32_angletrk
  * \{ */
 
@@ -308,6 +308,151 @@ void VecWin_f32(float32 *X, const float32 *W, short nX, short nW, short incrX, s
 }
 
 
+void Ifx_Cf32_vecPwr(float32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, uint32 nX)
+{
+    uint32 i;
+
+    for (i = 0; (i + 1) < nX; i += 2)
+    {
+        R[i]     = IFX_Cf32_dot(&X[i]);
+        R[i + 1] = IFX_Cf32_dot(&X[i + 1]);
+    }
+
+    if (i < nX)
+    {
+        R[i] = IFX_Cf32_dot(&X[i]);
+    }
+}
+
+
+void Ifx_Cf32_vecMag(float32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, uint32 nX)
+{
+    uint32 i;
+
+    for (i = 0; (i + 1) < nX; i += 2)
+    {
+        R[i]     = IFX_Cf32_mag(&X[i]);
+        R[i + 1] = IFX_Cf32_mag(&X[i + 1]);
+    }
+
+    if (i < nX)
+    {
+        R[i] = IFX_Cf32_mag(&X[i]);
+    }
+}
+
+
+void Ifx_Cf32_vecMul(cfloat32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, const cfloat32 *IFX_CF32_RESTRICT Y, uint32 nX)
+{
+    uint32 i;
+
+    for (i = 0; (i + 1) < nX; i += 2)
+    {
+        R[i]     = IFX_Cf32_mul(&X[i], &Y[i]);
+        R[i + 1] = IFX_Cf32_mul(&X[i + 1], &Y[i + 1]);
+    }
+
+    if (i < nX)
+    {
+        R[i] = IFX_Cf32_mul(&X[i], &Y[i]);
+    }
+}
+
+
+void Ifx_Cf32_vecPwrdB(float32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, uint32 nX)
+{
+    uint32 i;
+
+    /* 20 * log10(|x|) = 10 * log10(|x|^2), no square root needed */
+    for (i = 0; (i + 1) < nX; i += 2)
+    {
+        R[i]     = (float32)10.0 * log10f(IFX_Cf32_dot(&X[i]));
+        R[i + 1] = (float32)10.0 * log10f(IFX_Cf32_dot(&X[i + 1]));
+    }
+
+    if (i < nX)
+    {
+        R[i] = (float32)10.0 * log10f(IFX_Cf32_dot(&X[i]));
+    }
+}
+
+
+void Ifx_Cf32_vecWin(float32 *IFX_CF32_RESTRICT R, const float32 *IFX_CF32_RESTRICT X, const float32 *IFX_CF32_RESTRICT W, uint32 nX, uint32 nW)
+{
+    uint32 step = nW / nX;
+    uint32 last = nX - 1;
+    uint32 i;
+
+    /* Both halves use the same window point */
+    for (i = 0; i < (nX / 2); i++)
+    {
+        float32 w = W[i * step];
+        R[i]        = X[i] * w;
+        R[last - i] = X[last - i] * w;
+    }
+}
+
+
+void Ifx_Cf32_vecWinPack(cfloat32 *IFX_CF32_RESTRICT R, const float32 *IFX_CF32_RESTRICT X, const float32 *IFX_CF32_RESTRICT W, uint32 nX, uint32 nW)
+{
+    uint32 step = nW / nX;
+    uint32 last = nX - 1;
+    uint32 i;
+
+    for (i = 0; i < (nX / 2); i++)
+    {
+        float32 w = W[i * step];
+        R[i].real        = X[i] * w;
+        R[i].imag        = 0.0;
+        R[last - i].real = X[last - i] * w;
+        R[last - i].imag = 0.0;
+    }
+}
+
+
+float32 Ifx_Cf32_vecMaxIdx(const float32 *IFX_CF32_RESTRICT X, uint32 nX, uint32 *IFX_CF32_RESTRICT index)
+{
+    /* Two independent running maxima (even and odd elements) shorten the compare chain,
+     * they are merged at the end keeping the lowest index on equality */
+    float32 max0 = X[0], max1 = X[0];
+    uint32  idx0 = 0, idx1 = 0;
+    uint32  i;
+
+    for (i = 1; (i + 1) < nX; i += 2)
+    {
+        if (X[i] > max1)
+        {
+            max1 = X[i];
+            idx1 = i;
+        }
+
+        if (X[i + 1] > max0)
+        {
+            max0 = X[i + 1];
+            idx0 = i + 1;
+        }
+    }
+
+    if (i < nX)
+    {
+        if (X[i] > max1)
+        {
+            max1 = X[i];
+            idx1 = i;
+        }
+    }
+
+    if ((max1 > max0) || ((max1 == max0) && (idx1 < idx0)))
+    {
+        max0 = max1;
+        idx0 = idx1;
+    }
+
+    *index = idx0;
+    return max0;
+}
+
+
 #ifdef __WIN32__
 
 #define ENDL "\r\n"
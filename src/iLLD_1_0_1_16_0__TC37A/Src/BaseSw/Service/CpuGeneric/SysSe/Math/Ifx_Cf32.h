@@ -50,6 +50,15 @@
 
 #define _DATAF(val) ((float32)(val))
 
+/** \brief Pointer qualifier of the vector kernels, the buffers passed to one call shall not overlap */
+#ifndef IFX_CF32_RESTRICT
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#define IFX_CF32_RESTRICT restrict
+#else
+#define IFX_CF32_RESTRICT
+#endif
+#endif
+
 /* Complex Arithmetic --------------------------------------------------------*/
 IFX_INLINE cfloat32 IFX_Cf32_exp(const cfloat32 *c)
 {
@@ -170,6 +179,29 @@ IFX_EXTERN float32 VecMinIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *m
 IFX_EXTERN float32 VecMaxIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *maxIdx);
 IFX_EXTERN void    VecHalfSwap_f32(float32 *X, short nX);
 
+/* Vector kernels ------------------------------------------------------------*/
+/* Out-of-place kernels with 32-bit lengths. Input and output buffers shall not
+ * overlap (IFX_CF32_RESTRICT). The loops handle two elements per iteration;
+ * cfloat32 buffers aligned on 8 bytes allow 64-bit loads and stores. */
+
+/** \brief R[i] = |X[i]|^2 */
+IFX_EXTERN void    Ifx_Cf32_vecPwr(float32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, uint32 nX);
+/** \brief R[i] = |X[i]| */
+IFX_EXTERN void    Ifx_Cf32_vecMag(float32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, uint32 nX);
+/** \brief R[i] = X[i] * Y[i] */
+IFX_EXTERN void    Ifx_Cf32_vecMul(cfloat32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, const cfloat32 *IFX_CF32_RESTRICT Y, uint32 nX);
+/** \brief R[i] = 10 * log10(|X[i]|^2), in one pass, same as CplxVecMag_f32() then VecPwrdB_f32() */
+IFX_EXTERN void    Ifx_Cf32_vecPwrdB(float32 *IFX_CF32_RESTRICT R, const cfloat32 *IFX_CF32_RESTRICT X, uint32 nX);
+/** \brief R[i] = X[i] * w(i), with w the symmetric window W of nW points stored as its first half
+ * (e.g. Ifx_g_WndF32_hannTable with IFX_WNDF32_TABLE_LENGTH), resampled to nX points.
+ * (nX <= nW) && ((nW % nX) == 0) && ((nX % 2) == 0). R may be passed to Ifx_FftF32_real(). */
+IFX_EXTERN void    Ifx_Cf32_vecWin(float32 *IFX_CF32_RESTRICT R, const float32 *IFX_CF32_RESTRICT X, const float32 *IFX_CF32_RESTRICT W, uint32 nX, uint32 nW);
+/** \brief R[i].real = X[i] * w(i), R[i].imag = 0: window and pack real samples as complex FFT input in one pass.
+ * Same window contract as Ifx_Cf32_vecWin() */
+IFX_EXTERN void    Ifx_Cf32_vecWinPack(cfloat32 *IFX_CF32_RESTRICT R, const float32 *IFX_CF32_RESTRICT X, const float32 *IFX_CF32_RESTRICT W, uint32 nX, uint32 nW);
+/** \brief Returns the maximum of X and its first index in *index, in one pass. nX > 0 */
+IFX_EXTERN float32 Ifx_Cf32_vecMaxIdx(const float32 *IFX_CF32_RESTRICT X, uint32 nX, uint32 *IFX_CF32_RESTRICT index);
+
 /* Helper functions ----------------------------------------------------------*/
 #ifdef __WIN32__
 #include <stdio.h>
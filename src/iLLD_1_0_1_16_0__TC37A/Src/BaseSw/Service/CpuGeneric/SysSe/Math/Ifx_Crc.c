@@ -41,6 +41,10 @@
 #include "Ifx_Crc.h"
 
 uint32 Ifx_Crc_reflect(uint32 crc, sint32 bitnum);
+static uint32 Ifx_Crc_tableEntry(const Ifc_Crc_Table *table, uint32 i);
+static uint32 Ifx_Crc_updateSlice(const Ifc_Crc_Table *table, uint32 crc, const uint8 *p, uint32 len);
+static uint32 Ifx_Crc_multiplyX(const Ifc_Crc_Table *table, uint32 a);
+static uint32 Ifx_Crc_multiplyModulo(const Ifc_Crc_Table *table, uint32 a, uint32 b);
 
 boolean Ifx_Crc_init(Ifc_Crc *driver, const Ifc_Crc_Table *table, sint32 direct, sint32 refout, uint32 crcinit, uint32 crcxor)
 {
@@ -140,40 +144,16 @@ boolean Ifx_Crc_createTable(Ifc_Crc_Table *table, sint32 order, uint32 polynom,
     table->refin      = refin;
     table->crchighbit = (uint32)1 << (order - 1);
     table->crcmask    = crcmask;
+    table->slices     = 0;
     // generate lookup table
     // make CRC lookup table used by table algorithms
     {
-        sint32 i, j;
-        uint32 bit, crc;
+        sint32 i;
+        uint32 crc;
 
         for (i = 0; i < 256; i++)
         {
-            crc = (uint32)i;
-
-            if (refin)
-            {
-                crc = Ifx_Crc_reflect(crc, 8);
-            }
-
-            crc <<= order - 8;
-
-            for (j = 0; j < 8; j++)
-            {
-                bit   = crc & table->crchighbit;
-                crc <<= 1;
-
-                if (bit)
-                {
-                    crc ^= polynom;
-                }
-            }
-
-            if (refin)
-            {
-                crc = Ifx_Crc_reflect(crc, order);
-            }
-
-            crc &= crcmask;
+            crc = Ifx_Crc_tableEntry(table, (uint32)i);
 
             if (order <= 8)
             {
@@ -196,8 +176,104 @@ boolean Ifx_Crc_createTable(Ifc_Crc_Table *table, sint32 order, uint32 polynom,
 }
 
 
+boolean Ifx_Crc_createTableSlice(Ifc_Crc_Table *table, sint32 order, uint32 polynom, sint32 refin, sint32 slices)
+{
+    uint32 (*crctab)[256] = (uint32 (*)[256])((uint32)table + sizeof(Ifc_Crc_Table));
+    sint32 i, k;
+    uint32 crc;
+
+    if ((order < 8) || (order > 32))
+    {
+        return FALSE;
+    }
+
+    if ((slices != 4) && (slices != 8))
+    {
+        return FALSE;
+    }
+
+    table->order      = order;
+    table->polynom    = polynom;
+    table->refin      = refin;
+    table->crchighbit = (uint32)1 << (order - 1);
+    table->crcmask    = ((((uint32)1 << (order - 1)) - 1) << 1) | 1;
+    table->slices     = slices;
+
+    if (polynom != (polynom & table->crcmask))
+    {
+        return FALSE;
+    }
+
+    // crctab[0] is the byte table, aligned on the MSB of the 32-bit register when not reflected.
+    // crctab[k] is the byte table followed by k zero bytes.
+    for (i = 0; i < 256; i++)
+    {
+        crc = Ifx_Crc_tableEntry(table, (uint32)i);
+
+        if (!refin)
+        {
+            crc <<= 32 - order;
+        }
+
+        crctab[0][i] = crc;
+    }
+
+    for (k = 1; k < slices; k++)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            crc = crctab[k - 1][i];
+
+            if (!refin)
+            {
+                crctab[k][i] = (crc << 8) ^ crctab[0][crc >> 24];
+            }
+            else
+            {
+                crctab[k][i] = (crc >> 8) ^ crctab[0][crc & 0xff];
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+
 // subroutines
 
+static uint32 Ifx_Crc_tableEntry(const Ifc_Crc_Table *table, uint32 i)
+{
+    // CRC of the byte i, for the table algorithms
+    sint32 j;
+    uint32 bit, crc = i;
+
+    if (table->refin)
+    {
+        crc = Ifx_Crc_reflect(crc, 8);
+    }
+
+    crc <<= table->order - 8;
+
+    for (j = 0; j < 8; j++)
+    {
+        bit   = crc & table->crchighbit;
+        crc <<= 1;
+
+        if (bit)
+        {
+            crc ^= table->polynom;
+        }
+    }
+
+    if (table->refin)
+    {
+        crc = Ifx_Crc_reflect(crc, table->order);
+    }
+
+    return crc & table->crcmask;
+}
+
+
 uint32 Ifx_Crc_reflect(uint32 crc, sint32 bitnum)
 {
     // reflects the lower 'bitnum' bits of 'crc'
@@ -223,14 +299,34 @@ uint32 Ifx_Crc_tableFast(Ifc_Crc *driver, uint8 *p, uint32 len)
     // fast lookup table algorithm without augmented zero bytes, e.g. used in pkzip.
     // only usable with polynom orders of 8, 16, 24 or 32.
 
-    uint32 crc              = driver->crcinit_direct;
-    sint32 orderMinusHeight = driver->table->order - 8;
+    return Ifx_Crc_finish(driver, Ifx_Crc_update(driver, Ifx_Crc_begin(driver), p, len));
+}
+
+
+uint32 Ifx_Crc_begin(Ifc_Crc *driver)
+{
+    uint32 crc = driver->crcinit_direct;
 
     if (driver->table->refin)
     {
         crc = Ifx_Crc_reflect(crc, driver->table->order);
     }
 
+    return crc;
+}
+
+
+uint32 Ifx_Crc_update(Ifc_Crc *driver, uint32 crc, const uint8 *p, uint32 len)
+{
+    // lookup table algorithm without augmented zero bytes, crc is the working register.
+
+    sint32 orderMinusHeight = driver->table->order - 8;
+
+    if (driver->table->slices != 0)
+    {
+        return Ifx_Crc_updateSlice(driver->table, crc, p, len);
+    }
+
     if (driver->table->order <= 8)
     {
         uint8 *crctab = (uint8 *)((uint32)driver->table + sizeof(Ifc_Crc_Table));
@@ -289,6 +385,13 @@ uint32 Ifx_Crc_tableFast(Ifc_Crc *driver, uint8 *p, uint32 len)
         }
     }
 
+    // remove the bits shifted out of the register
+    return crc & driver->table->crcmask;
+}
+
+
+uint32 Ifx_Crc_finish(Ifc_Crc *driver, uint32 crc)
+{
     if (driver->refout ^ driver->table->refin)
     {
         crc = Ifx_Crc_reflect(crc, driver->table->order);
@@ -301,6 +404,59 @@ uint32 Ifx_Crc_tableFast(Ifc_Crc *driver, uint8 *p, uint32 len)
 }
 
 
+uint32 Ifx_Crc_combine(Ifc_Crc *driver, uint32 crcA, uint32 crcB, uint32 lenB)
+{
+    // The register after B, starting from register r, is r.x^(8.lenB) mod P + (register after B starting from 0).
+    // Hence crc(A|B) register = (rA + rInit).x^(8.lenB) mod P + rB, computed in the non reflected bit order.
+
+    const Ifc_Crc_Table *table = driver->table;
+    uint32               rA, rB, xn, x8;
+    sint32               i;
+
+    rA = crcA ^ driver->crcxor;
+    rB = crcB ^ driver->crcxor;
+
+    if (driver->refout)
+    {
+        rA = Ifx_Crc_reflect(rA, table->order);
+        rB = Ifx_Crc_reflect(rB, table->order);
+    }
+
+    // xn = x^(8.lenB) mod P, by square and multiply
+    x8 = 1;
+
+    for (i = 0; i < 8; i++)
+    {
+        x8 = Ifx_Crc_multiplyX(table, x8);
+    }
+
+    xn = 1;
+
+    while (lenB != 0)
+    {
+        if (lenB & 1)
+        {
+            xn = Ifx_Crc_multiplyModulo(table, xn, x8);
+        }
+
+        x8     = Ifx_Crc_multiplyModulo(table, x8, x8);
+        lenB >>= 1;
+    }
+
+    rA = Ifx_Crc_multiplyModulo(table, rA ^ driver->crcinit_direct, xn) ^ rB;
+
+    if (driver->refout)
+    {
+        rA = Ifx_Crc_reflect(rA, table->order);
+    }
+
+    rA ^= driver->crcxor;
+    rA &= table->crcmask;
+
+    return rA;
+}
+
+
 uint32 Ifx_Crc_table(Ifc_Crc *driver, uint8 *p, uint32 len)
 {
     // normal lookup table algorithm with augmented zero bytes.
@@ -309,6 +465,11 @@ uint32 Ifx_Crc_table(Ifc_Crc *driver, uint8 *p, uint32 len)
     uint32 crc              = driver->crcinit_nondirect;
     sint32 orderMinusHeight = driver->table->order - 8;
 
+    if (driver->table->slices != 0)
+    {
+        return Ifx_Crc_tableSlice(driver, p, len);
+    }
+
     if (driver->table->refin)
     {
         crc = Ifx_Crc_reflect(crc, driver->table->order);
@@ -429,6 +590,124 @@ uint32 Ifx_Crc_table(Ifc_Crc *driver, uint8 *p, uint32 len)
 }
 
 
+uint32 Ifx_Crc_tableSlice(Ifc_Crc *driver, uint8 *p, uint32 len)
+{
+    // slicing-by-4/8 lookup table algorithm without augmented zero bytes.
+    // 4 or 8 independent table lookups per iteration instead of a serial chain of lookups.
+    // usable with polynom orders of 8 to 32.
+
+    return Ifx_Crc_finish(driver, Ifx_Crc_updateSlice(driver->table, Ifx_Crc_begin(driver), p, len));
+}
+
+
+static uint32 Ifx_Crc_updateSlice(const Ifc_Crc_Table *table, uint32 crc, const uint8 *p, uint32 len)
+{
+    const uint32 (*crctab)[256] = (const uint32 (*)[256])((uint32)table + sizeof(Ifc_Crc_Table));
+    uint32       w0, w1;
+
+    if (!table->refin)
+    {
+        // register aligned on the MSB
+        crc <<= 32 - table->order;
+
+        if (table->slices == 8)
+        {
+            while (len >= 8)
+            {
+                w0   = crc ^ (((uint32)p[0] << 24) | ((uint32)p[1] << 16) | ((uint32)p[2] << 8) | p[3]);
+                w1   = ((uint32)p[4] << 24) | ((uint32)p[5] << 16) | ((uint32)p[6] << 8) | p[7];
+                crc  = crctab[7][w0 >> 24] ^ crctab[6][(w0 >> 16) & 0xff] ^ crctab[5][(w0 >> 8) & 0xff] ^ crctab[4][w0 & 0xff]
+                       ^ crctab[3][w1 >> 24] ^ crctab[2][(w1 >> 16) & 0xff] ^ crctab[1][(w1 >> 8) & 0xff] ^ crctab[0][w1 & 0xff];
+                p   += 8;
+                len -= 8;
+            }
+        }
+
+        while (len >= 4)
+        {
+            w0   = crc ^ (((uint32)p[0] << 24) | ((uint32)p[1] << 16) | ((uint32)p[2] << 8) | p[3]);
+            crc  = crctab[3][w0 >> 24] ^ crctab[2][(w0 >> 16) & 0xff] ^ crctab[1][(w0 >> 8) & 0xff] ^ crctab[0][w0 & 0xff];
+            p   += 4;
+            len -= 4;
+        }
+
+        while (len--)
+        {
+            crc = (crc << 8) ^ crctab[0][(crc >> 24) ^ *p++];
+        }
+
+        crc >>= 32 - table->order;
+    }
+    else
+    {
+        // register aligned on the LSB
+        if (table->slices == 8)
+        {
+            while (len >= 8)
+            {
+                w0   = crc ^ (((uint32)p[3] << 24) | ((uint32)p[2] << 16) | ((uint32)p[1] << 8) | p[0]);
+                w1   = ((uint32)p[7] << 24) | ((uint32)p[6] << 16) | ((uint32)p[5] << 8) | p[4];
+                crc  = crctab[7][w0 & 0xff] ^ crctab[6][(w0 >> 8) & 0xff] ^ crctab[5][(w0 >> 16) & 0xff] ^ crctab[4][w0 >> 24]
+                       ^ crctab[3][w1 & 0xff] ^ crctab[2][(w1 >> 8) & 0xff] ^ crctab[1][(w1 >> 16) & 0xff] ^ crctab[0][w1 >> 24];
+                p   += 8;
+                len -= 8;
+            }
+        }
+
+        while (len >= 4)
+        {
+            w0   = crc ^ (((uint32)p[3] << 24) | ((uint32)p[2] << 16) | ((uint32)p[1] << 8) | p[0]);
+            crc  = crctab[3][w0 & 0xff] ^ crctab[2][(w0 >> 8) & 0xff] ^ crctab[1][(w0 >> 16) & 0xff] ^ crctab[0][w0 >> 24];
+            p   += 4;
+            len -= 4;
+        }
+
+        while (len--)
+        {
+            crc = (crc >> 8) ^ crctab[0][(crc & 0xff) ^ *p++];
+        }
+    }
+
+    return crc;
+}
+
+
+static uint32 Ifx_Crc_multiplyX(const Ifc_Crc_Table *table, uint32 a)
+{
+    // a.x mod P, non reflected bit order
+    uint32 bit = a & table->crchighbit;
+
+    a <<= 1;
+
+    if (bit)
+    {
+        a ^= table->polynom;
+    }
+
+    return a & table->crcmask;
+}
+
+
+static uint32 Ifx_Crc_multiplyModulo(const Ifc_Crc_Table *table, uint32 a, uint32 b)
+{
+    // a.b mod P, non reflected bit order
+    uint32 product = 0;
+    uint32 i;
+
+    for (i = table->crchighbit; i; i >>= 1)
+    {
+        product = Ifx_Crc_multiplyX(table, product);
+
+        if (b & i)
+        {
+            product ^= a;
+        }
+    }
+
+    return product;
+}
+
+
 uint32 Ifx_Crc_bitByBit(Ifc_Crc *driver, uint8 *p, uint32 len)
 {
     // bit by bit algorithm with augmented zero bytes.
@@ -63,6 +63,7 @@ typedef struct
     sint32 refin;
     uint32 crchighbit;
     uint32 crcmask;
+    sint32 slices; /**< \brief 0 for the byte tables below, else number of slicing tables, see Ifx_Crc_createTableSlice() */
 }Ifc_Crc_Table;
 typedef struct
 {
@@ -82,6 +83,22 @@ typedef struct
     uint32        crctab[256]; /**< \brief CRC Table, must be 2st member of the struct */
 }Ifc_Crc_Table32;
 
+/** \brief Slicing-by-4 tables, for all orders from 8 to 32
+ * The entries are aligned on the MSB for refin = 0, on the LSB for refin = 1 */
+typedef struct
+{
+    Ifc_Crc_Table data;           /**< \brief CRC data, must be 1st member of the struct */
+    uint32        crctab[4][256]; /**< \brief CRC Tables, must be 2st member of the struct */
+}Ifc_Crc_TableSlice4;
+
+/** \brief Slicing-by-8 tables, for all orders from 8 to 32
+ * The entries are aligned on the MSB for refin = 0, on the LSB for refin = 1 */
+typedef struct
+{
+    Ifc_Crc_Table data;           /**< \brief CRC data, must be 1st member of the struct */
+    uint32        crctab[8][256]; /**< \brief CRC Tables, must be 2st member of the struct */
+}Ifc_Crc_TableSlice8;
+
 typedef struct
 {
     uint32               crcxor;
@@ -112,6 +129,17 @@ boolean Ifx_Crc_init(Ifc_Crc *driver, const Ifc_Crc_Table *table, sint32 direct,
  * \param refin [0,1] specifies if a data byte is reflected before processing (UART) or not
  */
 boolean Ifx_Crc_createTable(Ifc_Crc_Table *table, sint32 order, uint32 polynom, sint32 refin);
+/**
+ * Create the tables for the slicing-by-4 or slicing-by-8 algorithm, see Ifx_Crc_tableSlice().
+ * The driver initialised with such a table may be used with all the Ifx_Crc_* algorithms,
+ * Ifx_Crc_table() and Ifx_Crc_tableFast() then use Ifx_Crc_tableSlice().
+ * \param table pointer to the crc table: Ifc_Crc_TableSlice4 or Ifc_Crc_TableSlice8
+ * \param order [8..32] is the CRC polynom order, counted without the leading '1' bit
+ * \param polynom is the CRC polynom without leading '1' bit
+ * \param refin [0,1] specifies if a data byte is reflected before processing (UART) or not
+ * \param slices [4,8] number of tables, 4 for Ifc_Crc_TableSlice4, 8 for Ifc_Crc_TableSlice8
+ */
+boolean Ifx_Crc_createTableSlice(Ifc_Crc_Table *table, sint32 order, uint32 polynom, sint32 refin, sint32 slices);
 
 #if CRC_ENABLE_DPIPE
 boolean Ifx_Crc_Test(Ifc_Crc *driver, uint8 *string, uint32 length, IfxStdIf_DPipe *io);
@@ -119,6 +147,60 @@ void    Ifx_Crc_printTable(Ifc_Crc_Table *table, IfxStdIf_DPipe *io);
 #endif
 uint32 Ifx_Crc_tableFast(Ifc_Crc *driver, uint8 *p, uint32 len);
 uint32 Ifx_Crc_table(Ifc_Crc *driver, uint8 *p, uint32 len);
+/**
+ * Slicing-by-4/8 lookup table algorithm without augmented zero bytes, 4 or 8 bytes per iteration.
+ * Same result as the other algorithms, the driver table must have been created by Ifx_Crc_createTableSlice().
+ */
+uint32 Ifx_Crc_tableSlice(Ifc_Crc *driver, uint8 *p, uint32 len);
+
+/**
+ * Start a streaming CRC computation, see Ifx_Crc_update() and Ifx_Crc_finish().
+ *
+ * The data may then be fed in any number of chunks, e.g. as DMA buffers arrive:
+ * \code
+ * uint32 crc = Ifx_Crc_begin(&driver);
+ * crc = Ifx_Crc_update(&driver, crc, chunk1, length1);
+ * crc = Ifx_Crc_update(&driver, crc, chunk2, length2);
+ * crc = Ifx_Crc_finish(&driver, crc);
+ * \endcode
+ * The result is the same as Ifx_Crc_tableFast() over the concatenated chunks.
+ *
+ * As software fallback of IfxFce_Crc_calculateCrc() with the default configuration of
+ * IfxFce_Crc_initCrcConfig() (CRC kernel 0 or 1) and crcStartValue 0xFFFFFFFF, the driver shall
+ * be initialised for CRC-32: order 32, polynom 0x04C11DB7, refin 1, direct 1, refout 1,
+ * crcinit 0xFFFFFFFF, crcxor 0xFFFFFFFF. The data words are then processed in memory (little endian) byte order.
+ * \param driver pointer to the crc driver
+ * \return the working register, to be passed to Ifx_Crc_update()
+ */
+uint32 Ifx_Crc_begin(Ifc_Crc *driver);
+/**
+ * Process the next chunk of data of a streaming CRC computation.
+ * Works with byte tables (Ifx_Crc_createTable()) and slicing tables (Ifx_Crc_createTableSlice()).
+ * \param driver pointer to the crc driver
+ * \param crc working register returned by Ifx_Crc_begin() or the previous Ifx_Crc_update()
+ * \param p pointer to the data
+ * \param len data length in bytes
+ * \return the updated working register
+ */
+uint32 Ifx_Crc_update(Ifc_Crc *driver, uint32 crc, const uint8 *p, uint32 len);
+/**
+ * Complete a streaming CRC computation: apply the output reflection and the final XOR.
+ * \param driver pointer to the crc driver
+ * \param crc working register returned by the last Ifx_Crc_update()
+ * \return the CRC
+ */
+uint32 Ifx_Crc_finish(Ifc_Crc *driver, uint32 crc);
+/**
+ * Combine the CRCs of two consecutive blocks A and B into the CRC of A followed by B, without the data.
+ * Allows e.g. to compute the CRC of flash sectors in parallel on several cores, and to merge the results.
+ * The cost is O(log(lenB)), independent of the data.
+ * \param driver pointer to the crc driver
+ * \param crcA CRC of the block A, as returned by Ifx_Crc_finish() or Ifx_Crc_tableFast()
+ * \param crcB CRC of the block B
+ * \param lenB length in bytes of the block B
+ * \return the CRC of A followed by B
+ */
+uint32 Ifx_Crc_combine(Ifc_Crc *driver, uint32 crcA, uint32 crcB, uint32 lenB);
 uint32 Ifx_Crc_bitByBit(Ifc_Crc *driver, uint8 *p, uint32 len);
 uint32 Ifx_Crc_bitByBitFast(Ifc_Crc *driver, uint8 *p, uint32 len);
 /** \} */
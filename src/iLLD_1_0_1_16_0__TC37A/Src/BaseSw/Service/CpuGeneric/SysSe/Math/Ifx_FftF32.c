@@ -45,6 +45,41 @@
 
 //#include "Compiler.h"
 
+#if (IFX_CFG_FFTF32_COMPACT_TABLES)
+float32        *Ifx_g_FftF32_sineTable   = NULL_PTR;
+uint32          Ifx_g_FftF32_tableLength = 0;
+
+static float32  Ifx_FftF32_sineTableBuffer[IFX_FFTF32_SINE_TABLE_SIZE(IFX_FFTF32_MAX_LENGTH)];
+
+boolean Ifx_FftF32_initTables(float32 *arena, uint32 maxLength)
+{
+    uint32 i;
+
+    if ((maxLength < 4) || (maxLength > IFX_FFTF32_MAX_LENGTH) || ((maxLength & (maxLength - 1)) != 0))
+    {
+        return FALSE;
+    }
+
+    if (arena == NULL_PTR)
+    {
+        arena = Ifx_FftF32_sineTableBuffer;
+    }
+
+    /* Quarter wave only, the other quadrants are obtained by symmetry */
+    for (i = 0; i <= (maxLength / 4); i++)
+    {
+        arena[i] = (float32)sin(2 * IFX_PI * i / maxLength);
+    }
+
+    Ifx_g_FftF32_sineTable   = arena;
+    Ifx_g_FftF32_tableLength = maxLength;
+
+    return TRUE;
+}
+
+
+#endif
+
 cfloat32 *Ifx_FftF32_generateTwiddleFactor(cfloat32 *TF, short nX)
 {
     int    i;
@@ -180,3 +215,257 @@ cfloat32 *Ifx_FftF32_radix2I(cfloat32 *R, const cfloat32 *X, unsigned short nX)
 
     return R;
 }
+
+
+/******************************************************************************/
+static void Ifx_FftF32_bitReverseInPlace(cfloat32 *R, unsigned int logN, unsigned short nX)
+{
+    unsigned short n, k;
+    cfloat32       tmp;
+#if (IFX_CFG_FFTF32_COMPACT_TABLES)
+    unsigned short bit;
+
+    (void)logN;
+    k = 0;
+#endif
+
+    /* Each pair is swapped once, from the lower index only */
+    for (n = 0; n < nX; n++)
+    {
+#if !(IFX_CFG_FFTF32_COMPACT_TABLES)
+        k = Ifx_FftF32_lookUpReversedBits(n, logN);
+#endif
+
+        if (k > n)
+        {
+            tmp  = R[n];
+            R[n] = R[k];
+            R[k] = tmp;
+        }
+
+#if (IFX_CFG_FFTF32_COMPACT_TABLES)
+        /* bit-reversed increment of k */
+        bit = nX >> 1;
+
+        while ((k & bit) != 0)
+        {
+            k   = k ^ bit;
+            bit = bit >> 1;
+        }
+
+        k = k | bit;
+#endif
+    }
+}
+
+
+/******************************************************************************/
+static void Ifx_FftF32_radix4DecimationInTime(cfloat32 *R, unsigned long p)
+{
+    /* Same passes as Ifx_FftF32_radix2DecimationInTime, but two consecutive
+     * radix-2 passes are fused into one radix-4 butterfly (radix-2^2), so the
+     * data is walked only p/2 times and only two twiddle factors are loaded
+     * per 4 points. The twiddle factor of the second half of the 4L-points
+     * block is obtained from the first one by a free multiplication with -j.
+     * N.B. The input array R is in bit reversed order!
+     */
+    unsigned long N = 1UL << p;
+    unsigned long L, Np, b, k, stride, i1, i2;
+    cfloat32     *R0, *R1, *R2, *R3;
+    cfloat32      W1, W2, x0, t1, t3, b0, b1, b2, b3, u;
+
+    L = 1; /*No. of points in each sub-transform*/
+
+    if ((p & 1) != 0)
+    {
+        /*odd number of passes: single radix-2 pass, twiddle factor is 1*/
+        for (b = 0; b < N; b += 2)
+        {
+            x0       = R[b];
+            R[b]     = IFX_Cf32_add(&x0, &R[b + 1]);
+            R[b + 1] = IFX_Cf32_sub(&x0, &R[b + 1]);
+        }
+
+        L = 2;
+    }
+
+    for ( ; L < N; L = Np)
+    {
+        /*pass loop*/
+        Np     = L << 2;                        /*No. of points in each block*/
+        stride = Ifx_FftF32_getTwiddleStride(Np); /*twiddle index step for W(Np)^k*/
+
+        for (b = 0; b < N; b += Np)
+        {
+            /*block loop*/
+            R0 = &R[b];
+            R1 = R0 + L;
+            R2 = R1 + L;
+            R3 = R2 + L;
+            i1 = 0;                             /*index of W(Np)^k*/
+            i2 = 0;                             /*index of W(Np)^2k = W(Np/2)^k*/
+
+            for (k = 0; k < L; k++)
+            {
+                /*butterfly loop*/
+                W1    = Ifx_FftF32_getTwiddleFactor(i1);
+                W2    = Ifx_FftF32_getTwiddleFactor(i2);
+
+                /*first radix-2 pass: two blocks of Np/2 points*/
+                t1    = IFX_Cf32_mul(&R1[k], &W2);
+                t3    = IFX_Cf32_mul(&R3[k], &W2);
+                x0    = R0[k];
+                b0    = IFX_Cf32_add(&x0, &t1);
+                b1    = IFX_Cf32_sub(&x0, &t1);
+                x0    = R2[k];
+                b2    = IFX_Cf32_add(&x0, &t3);
+                b3    = IFX_Cf32_sub(&x0, &t3);
+
+                /*second radix-2 pass: W(Np)^(k+L) = -j * W(Np)^k*/
+                u     = IFX_Cf32_mul(&b2, &W1);
+                R0[k] = IFX_Cf32_add(&b0, &u);
+                R2[k] = IFX_Cf32_sub(&b0, &u);
+
+                t1     = IFX_Cf32_mul(&b3, &W1);
+                u.real = t1.imag;
+                u.imag = -t1.real;
+                R1[k]  = IFX_Cf32_add(&b1, &u);
+                R3[k]  = IFX_Cf32_sub(&b1, &u);
+
+                i1    = i1 + stride;
+                i2    = i2 + (stride << 1);
+            } /*butterfly loop*/
+        } /*block loop*/
+    } /*pass loop*/
+} /*Ifx_FftF32_radix4DecimationInTime*/
+
+
+cfloat32 *Ifx_FftF32_radix4(cfloat32 *R, const cfloat32 *X, unsigned short nX)
+{
+    unsigned int   logN = 31 - __clz(nX);
+    unsigned short n;
+
+    if (R != X)
+    {
+        for (n = 0; n < nX; n++)
+        {
+            R[n] = X[n];
+        }
+    }
+
+    Ifx_FftF32_bitReverseInPlace(R, logN, nX);
+
+    Ifx_FftF32_radix4DecimationInTime(R, logN);
+
+    return R;
+}
+
+
+cfloat32 *Ifx_FftF32_radix4I(cfloat32 *R, const cfloat32 *X, unsigned short nX)
+{
+    unsigned int   logN = 31 - __clz(nX);
+    unsigned short n;
+
+    /* Conjugate the input */
+    for (n = 0; n < nX; n++)
+    {
+        R[n].real = X[n].real;
+        R[n].imag = -X[n].imag;
+    }
+
+    Ifx_FftF32_bitReverseInPlace(R, logN, nX);
+
+    Ifx_FftF32_radix4DecimationInTime(R, logN);
+
+    /* Conjugate the output */
+    for (n = 0; n < nX; n++)
+    {
+        R[n].imag = -R[n].imag;
+    }
+
+    return R;
+}
+
+
+cfloat32 *Ifx_FftF32_real(cfloat32 *R, const float32 *X, unsigned short nX)
+{
+    /* The nX real samples are seen as nX/2 complex samples z[n] = x[2n] + j.x[2n+1].
+     * With Z = FFT(z), the spectrum of x is split from Z by:
+     *   Xe[k] = (Z[k] + conj(Z[M-k])) / 2
+     *   Xo[k] = (Z[k] - conj(Z[M-k])) / 2j
+     *   X[k]  = Xe[k] + W(nX)^k.Xo[k]
+     *   X[M-k] = conj(Xe[k] - W(nX)^k.Xo[k])
+     * where M = nX/2. Both bins k and M-k are computed from the same pair of
+     * inputs, so the post-processing is done in place.
+     */
+    unsigned short M      = nX >> 1;
+    unsigned short k;
+    unsigned long  stride = Ifx_FftF32_getTwiddleStride(nX);
+    cfloat32       A, B, W, Xe, Xo, T;
+
+    Ifx_FftF32_radix4(R, (const cfloat32 *)X, M);
+
+    /* DC in real part, Nyquist in imaginary part */
+    A         = R[0];
+    R[0].real = A.real + A.imag;
+    R[0].imag = A.real - A.imag;
+
+    for (k = 1; k <= (M >> 1); k++)
+    {
+        W             = Ifx_FftF32_getTwiddleFactor(k * stride);
+        A             = R[k];
+        B             = R[M - k];
+        Xe.real       = 0.5f * (A.real + B.real);
+        Xe.imag       = 0.5f * (A.imag - B.imag);
+        Xo.real       = 0.5f * (A.imag + B.imag);
+        Xo.imag       = 0.5f * (B.real - A.real);
+        T             = IFX_Cf32_mul(&Xo, &W);
+        R[k]          = IFX_Cf32_add(&Xe, &T);
+        R[M - k].real = Xe.real - T.real;
+        R[M - k].imag = T.imag - Xe.imag;
+    }
+
+    return R;
+}
+
+
+float32 *Ifx_FftF32_realI(float32 *R, const cfloat32 *X, unsigned short nX)
+{
+    /* Inverse of Ifx_FftF32_real(): Z[k] = E[k] + j.D[k] is rebuilt with
+     *   E[k] = X[k] + conj(X[M-k])
+     *   D[k] = (X[k] - conj(X[M-k])).conj(W(nX)^k)
+     * and Z[M-k] = conj(E[k]) + j.conj(D[k]), then z = IFFT(Z) gives the real
+     * samples interleaved. Like Ifx_FftF32_radix2I(), the result is not
+     * scaled by 1/nX.
+     */
+    unsigned short M      = nX >> 1;
+    unsigned short k;
+    unsigned long  stride = Ifx_FftF32_getTwiddleStride(nX);
+    cfloat32      *Z      = (cfloat32 *)R;
+    cfloat32       A, B, W, E, D, T;
+
+    A         = X[0];
+    Z[0].real = A.real + A.imag;
+    Z[0].imag = A.real - A.imag;
+
+    for (k = 1; k <= (M >> 1); k++)
+    {
+        W             = Ifx_FftF32_getTwiddleFactor(k * stride);
+        A             = X[k];
+        B             = X[M - k];
+        E.real        = A.real + B.real;
+        E.imag        = A.imag - B.imag;
+        T.real        = A.real - B.real;
+        T.imag        = A.imag + B.imag;
+        D.real        = (T.real * W.real) + (T.imag * W.imag);
+        D.imag        = (T.imag * W.real) - (T.real * W.imag);
+        Z[k].real     = E.real - D.imag;
+        Z[k].imag     = E.imag + D.real;
+        Z[M - k].real = E.real + D.imag;
+        Z[M - k].imag = D.real - E.imag;
+    }
+
+    Ifx_FftF32_radix4I(Z, Z, M);
+
+    return R;
+}
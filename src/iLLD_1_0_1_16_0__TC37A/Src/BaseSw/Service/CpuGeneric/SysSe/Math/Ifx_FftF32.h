@@ -50,21 +50,50 @@
 #define IFX_FFTF32_H
 
 #include "Ifx_Cf32.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** \brief Compact FFT tables.
+ *
+ * When set to 1, the constant \ref Ifx_g_FftF32_bitReverseTable and \ref Ifx_g_FftF32_twiddleTable
+ * (96 KiB of flash for \ref IFX_FFTF32_MAX_RESOLUTION 14) are not built. Instead, a quarter-wave sine
+ * table is generated at runtime by \ref Ifx_FftF32_initTables() for the largest length actually used,
+ * and the bit reversal is computed on the fly. \ref IFX_FFTF32_MAX_RESOLUTION may then be redefined
+ * freely, without regenerating any table.
+ */
+#ifndef IFX_CFG_FFTF32_COMPACT_TABLES
+#define IFX_CFG_FFTF32_COMPACT_TABLES (0)
+#endif
 
 /** \brief Maximum FFT resolution (bits).
  * If redefined, then \ref Ifx_g_FftF32_bitReverseTable and \ref Ifx_g_FftF32_twiddleTable shall be regenerated. */
+#ifndef IFX_FFTF32_MAX_RESOLUTION
 #define IFX_FFTF32_MAX_RESOLUTION (14)
+#endif
 
 /** \brief Maximum FFT length.
  * If redefined, then \ref Ifx_g_FftF32_bitReverseTable and \ref Ifx_g_FftF32_twiddleTable shall be regenerated. */
 #define IFX_FFTF32_MAX_LENGTH     (1U << IFX_FFTF32_MAX_RESOLUTION)
 
+/** \brief Size in float32 of the quarter-wave sine table for transforms up to \<length\> points */
+#define IFX_FFTF32_SINE_TABLE_SIZE(length) (((length) / 4) + 1)
+
+#if (IFX_CFG_FFTF32_COMPACT_TABLES)
+/** \brief Quarter-wave sine table, sin(2.pi.i / \ref Ifx_g_FftF32_tableLength) for i = 0 .. length / 4 */
+IFX_EXTERN float32           *Ifx_g_FftF32_sineTable;
+
+/** \brief Largest transform length supported by \ref Ifx_g_FftF32_sineTable, 0 if not initialised */
+IFX_EXTERN uint32             Ifx_g_FftF32_tableLength;
+#else
 /** \brief Bit reversal table */
 IFX_EXTERN IFX_CONST uint16   Ifx_g_FftF32_bitReverseTable[IFX_FFTF32_MAX_LENGTH];
 
 /** \brief Twiddle factor table */
 IFX_EXTERN IFX_CONST cfloat32 Ifx_g_FftF32_twiddleTable[IFX_FFTF32_MAX_LENGTH / 2];
 
+/** \brief Largest transform length supported by \ref Ifx_g_FftF32_twiddleTable */
+#define Ifx_g_FftF32_tableLength (IFX_FFTF32_MAX_LENGTH)
+#endif
+
 //----------------------------------------------------------------------------------------
 /** \addtogroup library_srvsw_sysse_math_f32_fft
  * \{ */
@@ -81,29 +110,123 @@ IFX_EXTERN cfloat32 *Ifx_FftF32_radix2(cfloat32 *R, const cfloat32 *X, uint16 nX
 /** \brief Radix-2 Inverse Fast-Fourier Transform */
 IFX_EXTERN cfloat32 *Ifx_FftF32_radix2I(cfloat32 *R, const cfloat32 *X, uint16 nX);
 
+/** \brief Mixed radix-4 / radix-2 Fast-Fourier Transform
+ *
+ * Same result as \ref Ifx_FftF32_radix2 (within floating-point rounding), computed with
+ * radix-4 passes and a single radix-2 pass when log2(nX) is odd. The bit reversal is
+ * done in place, so R may be equal to X.
+ * \param R Result, nX points
+ * \param X Input, nX points
+ * \param nX Number of points, power of 2 and not more than \ref IFX_FFTF32_MAX_LENGTH
+ * \return R */
+IFX_EXTERN cfloat32 *Ifx_FftF32_radix4(cfloat32 *R, const cfloat32 *X, uint16 nX);
+
+/** \brief Mixed radix-4 / radix-2 Inverse Fast-Fourier Transform
+ *
+ * Same result as \ref Ifx_FftF32_radix2I (within floating-point rounding). R may be equal to X.
+ * \param R Result, nX points
+ * \param X Input, nX points
+ * \param nX Number of points, power of 2 and not more than \ref IFX_FFTF32_MAX_LENGTH
+ * \return R */
+IFX_EXTERN cfloat32 *Ifx_FftF32_radix4I(cfloat32 *R, const cfloat32 *X, uint16 nX);
+
+/** \brief Real-input Fast-Fourier Transform
+ *
+ * Computes the nX points spectrum of nX real samples with a nX/2 points complex transform,
+ * without copying the samples into a complex buffer. Only the nX/2 non-redundant bins are
+ * returned (half-spectrum), bin k = 1 .. nX/2-1 in R[k]. Since the DC and Nyquist bins are
+ * real, they are packed into R[0]: DC in R[0].real, Nyquist in R[0].imag. Before calling
+ * CplxVecPwr_f32(R, nX/2), R[0].imag shall be cleared if bin 0 shall contain the DC power only.
+ * \param R Result, nX/2 points. May be the same buffer as X
+ * \param X Input, nX real samples
+ * \param nX Number of real samples, power of 2, from 2 to \ref IFX_FFTF32_MAX_LENGTH
+ * \return R */
+IFX_EXTERN cfloat32 *Ifx_FftF32_real(cfloat32 *R, const float32 *X, uint16 nX);
+
+/** \brief Real-output Inverse Fast-Fourier Transform
+ *
+ * Inverse of \ref Ifx_FftF32_real, X uses the same packed half-spectrum format. As for
+ * \ref Ifx_FftF32_radix2I, the result is not scaled, i.e. R = nX * x.
+ * \param R Result, nX real samples. May be the same buffer as X
+ * \param X Input, nX/2 points packed half-spectrum
+ * \param nX Number of real samples, power of 2, from 2 to \ref IFX_FFTF32_MAX_LENGTH
+ * \return R */
+IFX_EXTERN float32 *Ifx_FftF32_realI(float32 *R, const cfloat32 *X, uint16 nX);
+
 /** \} */
 //----------------------------------------------------------------------------------------
 /** \name Utility functions
  * \{ */
 
+/** \brief Calculate the bit-reversed \<n\> with \<bits\> as number of bits */
+IFX_EXTERN uint16 Ifx_FftF32_reverseBits(uint16 n, unsigned bits);
+
+/** \brief Generate the quarter-wave sine table used with \ref IFX_CFG_FFTF32_COMPACT_TABLES
+ *
+ * Only available with \ref IFX_CFG_FFTF32_COMPACT_TABLES = 1, and shall be called before any transform.
+ * It may be called again to change the maximum length, in which case no transform shall be running.
+ * \param arena RAM buffer of \ref IFX_FFTF32_SINE_TABLE_SIZE(maxLength) float32 receiving the table.
+ * If NULL_PTR, an internal buffer sized for \ref IFX_FFTF32_MAX_LENGTH is used.
+ * \param maxLength Largest transform length which will be used, power of 2, from 4 to \ref IFX_FFTF32_MAX_LENGTH
+ * \return TRUE if the table was generated, FALSE if maxLength is invalid */
+IFX_EXTERN boolean Ifx_FftF32_initTables(float32 *arena, uint32 maxLength);
+
 /** \brief Lookup from \ref Ifx_g_FftF32_bitReverseTable the bit-reversed \<n\> with \<bits\> as number of bits */
 IFX_INLINE uint16 Ifx_FftF32_lookUpReversedBits(uint16 n, unsigned bits)
 {
+#if (IFX_CFG_FFTF32_COMPACT_TABLES)
+    return Ifx_FftF32_reverseBits(n, bits);
+#else
     unsigned shift = IFX_FFTF32_MAX_RESOLUTION - bits;
     uint16   index = Ifx_g_FftF32_bitReverseTable[n];
     return index >> shift;
+#endif
 }
 
 
-/** \brief Lookup from \ref Ifx_g_FftF32_twiddleTable the twiddle factor for N, k */
-IFX_INLINE cfloat32 Ifx_FftF32_lookUpTwiddleFactor(sint32 N, sint32 k)
+/** \brief Get the twiddle factor W^index, W = exp(-j.2.pi / \ref Ifx_g_FftF32_tableLength)
+ * \param index 0 .. \ref Ifx_g_FftF32_tableLength / 2 - 1 */
+IFX_INLINE cfloat32 Ifx_FftF32_getTwiddleFactor(uint32 index)
 {
-    return Ifx_g_FftF32_twiddleTable[k * IFX_FFTF32_MAX_LENGTH / N];
+#if (IFX_CFG_FFTF32_COMPACT_TABLES)
+    uint32   quarter = Ifx_g_FftF32_tableLength >> 2;
+    cfloat32 W;
+
+    if (index <= quarter)
+    {
+        W.real = Ifx_g_FftF32_sineTable[quarter - index];
+        W.imag = -Ifx_g_FftF32_sineTable[index];
+    }
+    else
+    {
+        index  = index - quarter;
+        W.real = -Ifx_g_FftF32_sineTable[index];
+        W.imag = -Ifx_g_FftF32_sineTable[quarter - index];
+    }
+
+    return W;
+#else
+    return Ifx_g_FftF32_twiddleTable[index];
+#endif
 }
 
 
-/** \brief Calculate the bit-reversed \<n\> with \<bits\> as number of bits */
-IFX_EXTERN uint16 Ifx_FftF32_reverseBits(uint16 n, unsigned bits);
+/** \brief Index step in \ref Ifx_FftF32_getTwiddleFactor() between W(N)^k and W(N)^(k+1)
+ * \param N Transform length, power of 2 up to \ref Ifx_g_FftF32_tableLength */
+IFX_INLINE uint32 Ifx_FftF32_getTwiddleStride(uint32 N)
+{
+    /* a longer transform than the tables would get a stride of 0 */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (N != 0) && (N <= Ifx_g_FftF32_tableLength) && ((Ifx_g_FftF32_tableLength % N) == 0));
+
+    return Ifx_g_FftF32_tableLength / N;
+}
+
+
+/** \brief Lookup from \ref Ifx_g_FftF32_twiddleTable the twiddle factor for N, k */
+IFX_INLINE cfloat32 Ifx_FftF32_lookUpTwiddleFactor(sint32 N, sint32 k)
+{
+    return Ifx_FftF32_getTwiddleFactor((uint32)k * Ifx_FftF32_getTwiddleStride((uint32)N));
+}
 
 /** \} */
 //----------------------------------------------------------------------------------------
@@ -42,6 +42,7 @@
 
 #include "Ifx_FftF32.h"
 
+#if !(IFX_CFG_FFTF32_COMPACT_TABLES)
 /*lint -e915*/
 CONST_CFG unsigned short Ifx_g_FftF32_bitReverseTable[IFX_FFTF32_MAX_LENGTH] = {
     0,
@@ -16430,3 +16431,4 @@ CONST_CFG unsigned short Ifx_g_FftF32_bitReverseTable[IFX_FFTF32_MAX_LENGTH] = {
     16383,
 };
 /*lint +e915*/
+#endif
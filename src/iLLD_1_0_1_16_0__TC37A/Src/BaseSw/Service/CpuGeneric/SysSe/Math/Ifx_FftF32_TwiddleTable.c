@@ -42,6 +42,7 @@
 
 #include "Ifx_FftF32.h"
 
+#if !(IFX_CFG_FFTF32_COMPACT_TABLES)
 /*lint -e915*/
 IFX_CONST cfloat32 Ifx_g_FftF32_twiddleTable[IFX_FFTF32_MAX_LENGTH / 2] = {
     {_DATAF(1.00000000000000000000),  _DATAF(-0.00000000000000000000)},
@@ -8238,3 +8239,4 @@ IFX_CONST cfloat32 Ifx_g_FftF32_twiddleTable[IFX_FFTF32_MAX_LENGTH / 2] = {
     {_DATAF(-0.99999994039535522000), _DATAF(-0.00038349517853930593)},
 };
 /*lint +e915*/
+#endif
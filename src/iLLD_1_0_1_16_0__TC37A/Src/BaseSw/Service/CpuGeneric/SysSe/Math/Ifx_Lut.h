@@ -45,6 +45,10 @@
  * \defgroup library_srvsw_sysse_math_f32_lut Look-ups float32
  * \ingroup library_srvsw_sysse_math_lut
  *
+ * The batch look-ups (Ifx_LutAtan2F32_batch(), Ifx_LutSincosF32_batch()) fold the angle with selects
+ * instead of branches, so that the loop pipelines without branch and can be vectorized by the compiler
+ * where gathered loads are available. They return the same values as the scalar look-ups.
+ *
  */
 #ifndef IFX_LUT_H
 #define IFX_LUT_H
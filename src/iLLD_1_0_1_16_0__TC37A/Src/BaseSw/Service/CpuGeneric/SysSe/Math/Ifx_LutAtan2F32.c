@@ -81,6 +81,18 @@ IFX_INLINE float32 Ifx_LutAtan2F32_float32Private(float32 val)
 }
 
 
+/** \brief Branch-free variant of Ifx_LutAtan2F32_fxpAnglePrivate(), same rounding */
+IFX_INLINE Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAngleSelect(float32 valf)
+{
+    uint32 vali;
+    valf = IFX_LUTATAN2F32_SIZE * valf;
+    vali = (uint32)valf;
+    vali = vali + (((valf - (float32)vali) > 0.5f) ? 1 : 0);
+
+    return Ifx_g_LutAtan2F32_FxpAngle_table[vali];
+}
+
+
 Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAngle(float32 x, float32 y)
 {
     Ifx_Lut_FxpAngle angle;
@@ -199,3 +211,32 @@ float32 Ifx_LutAtan2F32_float32(float32 y, float32 x)
 
     return angle;
 }
+
+
+void Ifx_LutAtan2F32_batch(const float32 *y, const float32 *x, Ifx_Lut_FxpAngle *fxpAngle, uint32 n)
+{
+    uint32 i;
+
+    for (i = 0; i < n; i++)
+    {
+        float32          fx   = x[i];
+        float32          fy   = y[i];
+        float32          ax   = (fx < 0) ? -fx : fx;
+        float32          ay   = (fy < 0) ? -fy : fy;
+        /* Octant folding: the ratio is always in 0 .. 1 */
+        boolean          swap = (ay >= ax) && (ay != 0);
+        float32          num  = swap ? ax : ay;
+        float32          den  = swap ? ay : ax;
+        float32          ratio;
+        Ifx_Lut_FxpAngle angle;
+
+        den   = (den != 0) ? den : 1.0f;
+        ratio = num / den;
+        angle = Ifx_LutAtan2F32_fxpAngleSelect(ratio);
+        angle = swap ? ((IFX_LUT_ANGLE_PI / 2) - angle) : angle; /* 0 .. 90 deg */
+        angle = (fx < 0) ? (IFX_LUT_ANGLE_PI - angle) : angle;   /* 0 .. 180 deg */
+        angle = (fy < 0) ? -angle : angle;                       /* -180 .. 180 deg */
+
+        fxpAngle[i] = angle & (IFX_LUT_ANGLE_RESOLUTION - 1);
+    }
+}
@@ -70,4 +70,14 @@ IFX_EXTERN void Ifx_LutAtan2F32_init(void);
 IFX_EXTERN Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAngle(float32 x, float32 y);
 IFX_EXTERN float32          Ifx_LutAtan2F32_float32(float32 y, float32 x);
 
+/**
+ * \brief Ifx_LutAtan2F32_fxpAngle(x[i], y[i]) for n finite samples, x[i] = y[i] = 0 returns 0.
+ * \param y Pointer to the y (sine) samples
+ * \param x Pointer to the x (cosine) samples
+ * \param fxpAngle Pointer to the result, 0 .. (IFX_LUT_ANGLE_RESOLUTION - 1), which represents 0 .. 2*IFX_PI
+ * \param n Number of samples
+ * \ingroup library_srvsw_sysse_math_lut_atan2
+ */
+IFX_EXTERN void Ifx_LutAtan2F32_batch(const float32 *y, const float32 *x, Ifx_Lut_FxpAngle *fxpAngle, uint32 n);
+
 #endif
@@ -41,6 +41,7 @@
  */
 
 #include "Ifx_LutLinearF32.h"
+#include "_Utilities/Ifx_Assert.h"
 
 /** \brief Look-up table with binary search implementation
  *
@@ -94,3 +95,119 @@ float32 Ifx_LutLinearF32_searchBin(const Ifx_LutLinearF32 *ml, float32 index)
 
     return (ml->segments[imin].gain * index) + ml->segments[imin].offset;
 }
+
+
+/** \brief Initialise a multi-segment object, and detect uniform boundaries
+ *
+ * The boundaries are uniform when each one is within 1/8 step of the grid; the last boundary, which is not
+ * used by the search, is ignored. Ifx_LutLinearF32_search() then uses the direct index.
+ *
+ * \param ml pointer to the multi-segment object
+ * \param segments pointer to the segments, boundaries sorted in ascending or descending order
+ * \param segmentCount number of segments, at least 2
+ * \return TRUE if the boundaries are uniform */
+boolean Ifx_LutLinearF32_init(Ifx_LutLinearF32 *ml, const Ifx_LutLinearF32_Item *segments, sint16 segmentCount)
+{
+    sint16  i;
+    sint16  last = segmentCount - 2;     /* Last boundary used by the search */
+    float32 step;
+    boolean uniform;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, segmentCount >= 2);
+
+    ml->segmentCount = segmentCount;
+    ml->segments     = segments;
+    ml->origin       = segments[0].boundary;
+    ml->invStep      = 0;
+
+    if (last == 0)
+    {
+        step = segments[1].boundary - segments[0].boundary;
+    }
+    else
+    {
+        step = (segments[last].boundary - segments[0].boundary) / last;
+    }
+
+    uniform = (step != 0);
+
+    for (i = 1; (i <= last) && uniform; i++)
+    {
+        float32 error = segments[i].boundary - (ml->origin + (step * i));
+        error   = (error < 0) ? -error : error;
+        uniform = (error <= ((step < 0) ? -step : step) / 8);
+    }
+
+    if (uniform)
+    {
+        ml->invStep = 1.0f / step;
+    }
+
+    return uniform;
+}
+
+
+/** \brief Initialise a multi-segment object with uniform boundaries, resampled from another one
+ *
+ * Segment i, 1 <= i < segmentCount, is the chord of the source between first + (i - 1) * step and first + i * step.
+ * Segment 0 extrapolates the chord between first - step and first.
+ * The result matches the source at the grid points, and approximates it between them.
+ *
+ * \param ml pointer to the multi-segment object to initialise
+ * \param segments pointer to the segment storage, segmentCount items
+ * \param segmentCount number of segments, at least 2
+ * \param source pointer to the multi-segment object to resample
+ * \param first first boundary
+ * \param step boundary step, negative for descending boundaries */
+void Ifx_LutLinearF32_initUniform(Ifx_LutLinearF32 *ml, Ifx_LutLinearF32_Item *segments, sint16 segmentCount, const Ifx_LutLinearF32 *source, float32 first, float32 step)
+{
+    sint16  i;
+    float32 x0 = first - step;
+    float32 y0 = Ifx_LutLinearF32_searchBin(source, x0);
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (segmentCount >= 2) && (step != 0));
+
+    for (i = 0; i < segmentCount; i++)
+    {
+        float32 x1 = first + (step * i);
+        float32 y1 = Ifx_LutLinearF32_searchBin(source, x1);
+
+        segments[i].gain     = (y1 - y0) / (x1 - x0);
+        segments[i].offset   = y0 - (segments[i].gain * x0);
+        segments[i].boundary = x1;
+        x0                   = x1;
+        y0                   = y1;
+    }
+
+    ml->segmentCount = segmentCount;
+    ml->segments     = segments;
+    ml->origin       = first;
+    ml->invStep      = 1.0f / step;
+}
+
+
+/** \brief Look-up table search for a batch of inputs
+ *
+ * \param ml pointer to the multi-segment object
+ * \param index pointer to the inputs
+ * \param result pointer to the interpolated values
+ * \param n number of inputs */
+void Ifx_LutLinearF32_searchBatch(const Ifx_LutLinearF32 *ml, const float32 *index, float32 *result, uint32 n)
+{
+    uint32 i;
+
+    if (ml->invStep != 0)
+    {
+        for (i = 0; i < n; i++)
+        {
+            result[i] = Ifx_LutLinearF32_searchUniform(ml, index[i]);
+        }
+    }
+    else
+    {
+        for (i = 0; i < n; i++)
+        {
+            result[i] = Ifx_LutLinearF32_searchBin(ml, index[i]);
+        }
+    }
+}
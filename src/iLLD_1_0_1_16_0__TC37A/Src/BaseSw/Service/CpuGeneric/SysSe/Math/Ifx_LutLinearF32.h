@@ -58,10 +58,20 @@ typedef struct
     float32 boundary;    /**< \brief segment input upper limit */
 } Ifx_LutLinearF32_Item;
 
+/** \brief Multi-segment object
+ *
+ * Segment i applies to inputs in (segments[i - 1].boundary, segments[i].boundary] for ascending boundaries,
+ * [segments[i].boundary, segments[i - 1].boundary) for descending boundaries. The first and last segments are extrapolated.
+ *
+ * origin and invStep are set by Ifx_LutLinearF32_init() or Ifx_LutLinearF32_initUniform(). They are 0 for
+ * tables initialised statically with {segmentCount, segments}, in which case Ifx_LutLinearF32_search() uses the binary search.
+ */
 typedef struct
 {
-    sint8                          segmentCount;
-    const Ifx_LutLinearF32_Item *segments;
+    sint16                       segmentCount;  /**< \brief Number of segments, at least 2 */
+    const Ifx_LutLinearF32_Item *segments;      /**< \brief Segments, boundaries sorted in ascending or descending order */
+    float32                      origin;        /**< \brief Boundary of the first segment, uniform grid only */
+    float32                      invStep;       /**< \brief Inverse of the boundary step (negative for descending boundaries) for a uniform grid, else 0 */
 } Ifx_LutLinearF32;
 
 //________________________________________________________________________________________
@@ -70,6 +80,11 @@ typedef struct
 /** \addtogroup library_srvsw_sysse_math_f32_lut_linear
  * \{ */
 IFX_EXTERN float32 Ifx_LutLinearF32_searchBin(const Ifx_LutLinearF32 *ml, float32 index);
+IFX_EXTERN boolean Ifx_LutLinearF32_init(Ifx_LutLinearF32 *ml, const Ifx_LutLinearF32_Item *segments, sint16 segmentCount);
+IFX_EXTERN void    Ifx_LutLinearF32_initUniform(Ifx_LutLinearF32 *ml, Ifx_LutLinearF32_Item *segments, sint16 segmentCount, const Ifx_LutLinearF32 *source, float32 first, float32 step);
+IFX_EXTERN void    Ifx_LutLinearF32_searchBatch(const Ifx_LutLinearF32 *ml, const float32 *index, float32 *result, uint32 n);
+IFX_INLINE float32 Ifx_LutLinearF32_search(const Ifx_LutLinearF32 *ml, float32 index);
+IFX_INLINE float32 Ifx_LutLinearF32_searchUniform(const Ifx_LutLinearF32 *ml, float32 index);
 IFX_INLINE float32 Ifx_LutLinearF32_searchNegSeq(const Ifx_LutLinearF32 *ml, float32 index);
 IFX_INLINE float32 Ifx_LutLinearF32_searchPosSeq(const Ifx_LutLinearF32 *ml, float32 index);
 /** \} */
@@ -87,7 +102,7 @@ IFX_INLINE float32 Ifx_LutLinearF32_searchPosSeq(const Ifx_LutLinearF32 *ml, flo
  * \return interpolated value */
 IFX_INLINE float32 Ifx_LutLinearF32_searchPosSeq(const Ifx_LutLinearF32 *ml, float32 index)
 {
-    sint8 i = 0;
+    sint16 i = 0;
 
     while ((index > ml->segments[i].boundary) && (i < ml->segmentCount - 1))
     {
@@ -108,7 +123,7 @@ IFX_INLINE float32 Ifx_LutLinearF32_searchPosSeq(const Ifx_LutLinearF32 *ml, flo
  * \return interpolated value */
 IFX_INLINE float32 Ifx_LutLinearF32_searchNegSeq(const Ifx_LutLinearF32 *ml, float32 index)
 {
-    sint8 i = ml->segmentCount - 1;
+    sint16 i = ml->segmentCount - 1;
 
     while ((i - 1 >= 0) && (index > ml->segments[i - 1].boundary))
     {
@@ -119,4 +134,59 @@ IFX_INLINE float32 Ifx_LutLinearF32_searchNegSeq(const Ifx_LutLinearF32 *ml, flo
 }
 
 
+/** \brief Look-up table with direct index implementation, for uniform boundaries
+ *
+ * The segment is computed from the input position on the grid, and then corrected by a single boundary
+ * comparison on each side, so the result is identical to Ifx_LutLinearF32_searchBin().
+ * Value inside table will be linearly interpolated
+ * Value outside table will be linearly extrapolated
+ *
+ * \param ml pointer to the multi-segment object, with ml->invStep != 0
+ * \param index
+ * \return interpolated value */
+IFX_INLINE float32 Ifx_LutLinearF32_searchUniform(const Ifx_LutLinearF32 *ml, float32 index)
+{
+    const Ifx_LutLinearF32_Item *segments  = ml->segments;
+    sint32                       last      = ml->segmentCount - 1;
+    float32                      position  = (index - ml->origin) * ml->invStep;
+    boolean                      ascending = ml->invStep > 0;
+    sint32                       i;
+
+    /* Segment i applies to position in (i - 1, i] */
+    position = (position > -1.0f) ? position : -1.0f;
+    position = (position < (float32)last) ? position : (float32)last;
+    i        = (sint32)position;
+    i        = (((float32)i < position) ? (i + 1) : i);
+    i        = (i > 0) ? i : 0;
+
+    /* Correct the rounding at the boundaries */
+    if ((i > 0) && (ascending ? (index <= segments[i - 1].boundary) : (index >= segments[i - 1].boundary)))
+    {
+        i--;
+    }
+    else if ((i < last) && (ascending ? (index > segments[i].boundary) : (index < segments[i].boundary)))
+    {
+        i++;
+    }
+    else
+    {}
+
+    return (segments[i].gain * index) + segments[i].offset;
+}
+
+
+/** \brief Look-up table search, direct index for uniform boundaries, else binary search
+ *
+ * Value inside table will be linearly interpolated
+ * Value outside table will be linearly extrapolated
+ *
+ * \param ml pointer to the multi-segment object
+ * \param index
+ * \return interpolated value */
+IFX_INLINE float32 Ifx_LutLinearF32_search(const Ifx_LutLinearF32 *ml, float32 index)
+{
+    return (ml->invStep != 0) ? Ifx_LutLinearF32_searchUniform(ml, index) : Ifx_LutLinearF32_searchBin(ml, index);
+}
+
+
 #endif /* IFX_LUTLINEARF32_H */
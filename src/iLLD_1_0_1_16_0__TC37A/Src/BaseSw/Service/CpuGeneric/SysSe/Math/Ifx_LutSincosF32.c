@@ -85,3 +85,29 @@ float32 Ifx_LutSincosF32_sin(Ifx_Lut_FxpAngle fxpAngle)
 
     return result;
 }
+
+
+/** \brief Branch-free variant of Ifx_LutSincosF32_sin() */
+IFX_INLINE float32 Ifx_LutSincosF32_sinSelect(Ifx_Lut_FxpAngle fxpAngle)
+{
+    Ifx_Lut_FxpAngle quadrant = (fxpAngle >> (IFX_LUT_ANGLE_BITS - 2)) & 3;
+    Ifx_Lut_FxpAngle index    = fxpAngle & ((IFX_LUT_ANGLE_PI / 2) - 1);
+    float32          result;
+
+    index  = ((quadrant & 1) != 0) ? ((IFX_LUT_ANGLE_PI / 2) - index) : index;
+    result = Ifx_g_LutSincosF32_table[index];
+
+    return ((quadrant & 2) != 0) ? -result : result;
+}
+
+
+void Ifx_LutSincosF32_batch(const Ifx_Lut_FxpAngle *fxpAngle, cfloat32 *result, uint32 n)
+{
+    uint32 i;
+
+    for (i = 0; i < n; i++)
+    {
+        result[i].real = Ifx_LutSincosF32_sinSelect((IFX_LUT_ANGLE_PI / 2) - fxpAngle[i]);
+        result[i].imag = Ifx_LutSincosF32_sinSelect(fxpAngle[i]);
+    }
+}
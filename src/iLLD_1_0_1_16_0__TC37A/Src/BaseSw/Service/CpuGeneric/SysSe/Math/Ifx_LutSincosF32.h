@@ -100,5 +100,14 @@ IFX_INLINE cfloat32 Ifx_LutSincosF32_cossin(Ifx_Lut_FxpAngle fxpAngle)
 }
 
 
+/**
+ * \brief Ifx_LutSincosF32_cossin(fxpAngle[i]) for n angles
+ * \param fxpAngle Pointer to the angles, which represents 0 .. 2*IFX_PI for 0 .. IFX_LUT_ANGLE_RESOLUTION, any value is accepted
+ * \param result Pointer to the result, real = cos(fxpAngle[i]), imag = sin(fxpAngle[i])
+ * \param n Number of angles
+ * \ingroup library_srvsw_sysse_math_lut_sincos
+ */
+IFX_EXTERN void Ifx_LutSincosF32_batch(const Ifx_Lut_FxpAngle *fxpAngle, cfloat32 *result, uint32 n);
+
 //________________________________________________________________________________________
 #endif
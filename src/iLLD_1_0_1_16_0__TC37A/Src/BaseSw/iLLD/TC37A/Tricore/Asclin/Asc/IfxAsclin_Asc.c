@@ -475,19 +475,32 @@ void IfxAsclin_Asc_isrError(IfxAsclin_Asc *asclin)
 
 void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin)
 {
-    uint8 ascData[16]; /*FIFO size is 16 bytes*/
-
     switch (asclin->dataBufferMode)
     {
     case Ifx_DataBufferMode_normal:
     {
-        uint8 count;
-        count = IfxAsclin_getRxFifoFillLevel(asclin->asclin);
-        IfxAsclin_read8(asclin->asclin, &ascData[0], count);
-
-        if (Ifx_Fifo_write(asclin->rx, &ascData[0], count, TIME_NULL) != 0)
+        uint8         count;
+        Ifx_SizeT     reserved;
+        Ifx_Fifo_Span span;
+        count    = IfxAsclin_getRxFifoFillLevel(asclin->asclin);
+
+        /* Read the hardware FIFO directly into the software FIFO */
+        reserved = Ifx_Fifo_reserveWrite(asclin->rx, count, &span);
+        IfxAsclin_read8(asclin->asclin, span.data[0], span.count[0]);
+        IfxAsclin_read8(asclin->asclin, span.data[1], span.count[1]);
+        Ifx_Fifo_commitWrite(asclin->rx, reserved);
+
+        if (reserved != count)
         {
             /* Receive buffer is full, data is discard */
+            uint8 ascData;
+
+            while (reserved < count)
+            {
+                IfxAsclin_read8(asclin->asclin, &ascData, 1);
+                reserved++;
+            }
+
             asclin->rxSwFifoOverflow = TRUE;
         }
 
@@ -496,12 +509,13 @@ void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin)
     case Ifx_DataBufferMode_timeStampSingle:
     {
         Ifx_DataBufferMode_TimeStampSingle packedData;
+        uint8                              ascData;
 
         while (IfxAsclin_getRxFifoFillLevel(asclin->asclin) > 0)
         {
             packedData.timestamp = IfxStm_now();
-            IfxAsclin_read8(asclin->asclin, &ascData[0], 1);
-            packedData.data      = ascData[0];
+            IfxAsclin_read8(asclin->asclin, &ascData, 1);
+            packedData.data      = ascData;
 
             if (Ifx_Fifo_write(asclin->rx, &packedData, sizeof(packedData), TIME_NULL) != 0)
             {
@@ -526,7 +540,7 @@ void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin)
         {
         case Ifx_DataBufferMode_normal:
         {
-            uint8          ascData[16];
+            Ifx_Fifo_Span  span;
             uint16         count            = 0, i_count = 0;
             volatile uint8 hw_tx_fill_level = 0;
 
@@ -541,8 +555,11 @@ void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin)
                 i_count = count;
             }
 
-            Ifx_Fifo_read(asclin->tx, &ascData[0], i_count, TIME_NULL);
-            IfxAsclin_write8(asclin->asclin, &ascData[0], i_count);
+            /* Write the software FIFO content directly into the hardware FIFO */
+            i_count = (uint16)Ifx_Fifo_peekRead(asclin->tx, i_count, &span);
+            IfxAsclin_write8(asclin->asclin, span.data[0], span.count[0]);
+            IfxAsclin_write8(asclin->asclin, span.data[1], span.count[1]);
+            Ifx_Fifo_releaseRead(asclin->tx, i_count);
         }
         break;
 
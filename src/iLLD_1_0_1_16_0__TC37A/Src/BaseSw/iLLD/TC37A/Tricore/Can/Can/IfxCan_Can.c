@@ -47,6 +47,7 @@
 /******************************************************************************/
 
 #include "IfxCan_Can.h"
+#include "IfxCan_bf.h"
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -866,6 +867,156 @@ void IfxCan_Can_readMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint
 }
 
 
+uint32 IfxCan_Can_readFifoBatch(IfxCan_Can_Node *node, IfxCan_RxFifo fifo, IfxCan_Message *msgs, uint32 *data, uint32 maxCount)
+{
+    Ifx_CAN_N *canNode = node->node;
+    uint32     fillLevel, getIndex, fifoSize, slotSize, elementSize, elementBase;
+    uint32     count, i;
+
+    /* one status read for fill level and get index */
+    if (fifo == IfxCan_RxFifo_0)
+    {
+        Ifx_CAN_N_RX_F0S status;
+        status.U    = canNode->RX.F0S.U;
+        fillLevel   = status.B.F0FL;
+        getIndex    = status.B.F0GI;
+        fifoSize    = canNode->RX.F0C.B.F0S;
+        slotSize    = IfxCan_Node_getRxFifo0DataFieldSize(canNode);
+        elementBase = node->messageRAM.baseAddress + node->messageRAM.rxFifo0StartAddress;
+    }
+    else
+    {
+        Ifx_CAN_N_RX_F1S status;
+        status.U    = canNode->RX.F1S.U;
+        fillLevel   = status.B.F1FL;
+        getIndex    = status.B.F1GI;
+        fifoSize    = canNode->RX.F1C.B.F1S;
+        slotSize    = IfxCan_Node_getRxFifo1DataFieldSize(canNode);
+        elementBase = node->messageRAM.baseAddress + node->messageRAM.rxFifo1StartAddress;
+    }
+
+    elementSize = 8 + slotSize;
+    slotSize    = slotSize / 4;
+    count       = __minu(fillLevel, maxCount);
+
+    for (i = 0; i < count; i++)
+    {
+        uint32         *element = (uint32 *)(elementBase + (getIndex * elementSize));
+        uint32         *source  = &element[2];
+        uint32         *target  = &data[i * slotSize];
+        IfxCan_Message *message = &msgs[i];
+        Ifx_CAN_R0      r0;
+        Ifx_CAN_R1      r1;
+        uint32          length;
+
+        /* header decoded from the two header words */
+        r0.U                           = element[0];
+        r1.U                           = element[1];
+        message->messageIdLength       = (IfxCan_MessageIdLength)r0.B.XTD;
+        message->messageId             = r0.B.ID >> ((r0.B.XTD != 0) ? 0 : 18);
+        message->remoteTransmitRequest = r0.B.RTR;
+        message->errorStateIndicator   = r0.B.ESI;
+        message->dataLengthCode        = (IfxCan_DataLengthCode)r1.B.DLC;
+        message->bufferNumber          = (uint8)getIndex;
+        message->readFromRxFifo0       = (fifo == IfxCan_RxFifo_0);
+        message->readFromRxFifo1       = (fifo == IfxCan_RxFifo_1);
+
+        if (r1.B.FDF == 0)
+        {
+            message->frameMode = IfxCan_FrameMode_standard;
+        }
+        else
+        {
+            message->frameMode = (r1.B.BRS != 0) ? IfxCan_FrameMode_fdLongAndFast : IfxCan_FrameMode_fdLong;
+        }
+
+        /* data, limited to the slot size */
+        length = __minu(IfxCan_dataLengthWords[r1.B.DLC], slotSize);
+        IfxCan_Node_copyData(target, source, length);
+
+        getIndex = ((getIndex + 1) < fifoSize) ? (getIndex + 1) : 0;
+    }
+
+    /* acknowledging the last element read releases all elements read */
+    if (count != 0)
+    {
+        getIndex = ((getIndex != 0) ? getIndex : fifoSize) - 1;
+
+        if (fifo == IfxCan_RxFifo_0)
+        {
+            IfxCan_Node_setRxFifo0AcknowledgeIndex(canNode, (IfxCan_RxBufferId)getIndex);
+        }
+        else
+        {
+            IfxCan_Node_setRxFifo1AcknowledgeIndex(canNode, (IfxCan_RxBufferId)getIndex);
+        }
+    }
+
+    return count;
+}
+
+
+void IfxCan_Can_readMessageFast(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data)
+{
+    Ifx_CAN_N *canNode = node->node;
+    uint32    *element;
+    uint32     bufferId;
+    Ifx_CAN_R0 r0;
+    Ifx_CAN_R1 r1;
+
+    if (message->readFromRxFifo0)
+    {
+        bufferId = canNode->RX.F0S.B.F0GI;
+        element  = (uint32 *)IfxCan_Node_getRxFifo0ElementAddress(canNode, node->messageRAM.baseAddress, node->messageRAM.rxFifo0StartAddress, (IfxCan_RxBufferId)bufferId);
+    }
+    else if (message->readFromRxFifo1)
+    {
+        bufferId = canNode->RX.F1S.B.F1GI;
+        element  = (uint32 *)IfxCan_Node_getRxFifo1ElementAddress(canNode, node->messageRAM.baseAddress, node->messageRAM.rxFifo1StartAddress, (IfxCan_RxBufferId)bufferId);
+    }
+    else
+    {
+        bufferId = message->bufferNumber;
+        element  = (uint32 *)IfxCan_Node_getRxBufferElementAddress(canNode, node->messageRAM.baseAddress, node->messageRAM.rxBuffersStartAddress, (IfxCan_RxBufferId)bufferId);
+    }
+
+    /* one load per header word, decoded from the local copies */
+    r0.U                           = element[0];
+    r1.U                           = element[1];
+    message->messageIdLength       = (IfxCan_MessageIdLength)r0.B.XTD;
+    message->messageId             = r0.B.ID >> ((r0.B.XTD != 0) ? 0 : 18);
+    message->remoteTransmitRequest = r0.B.RTR;
+    message->errorStateIndicator   = r0.B.ESI;
+    message->dataLengthCode        = (IfxCan_DataLengthCode)r1.B.DLC;
+    message->bufferNumber          = (uint8)bufferId;
+
+    if (r1.B.FDF == 0)
+    {
+        message->frameMode = IfxCan_FrameMode_standard;
+    }
+    else
+    {
+        message->frameMode = (r1.B.BRS != 0) ? IfxCan_FrameMode_fdLongAndFast : IfxCan_FrameMode_fdLong;
+    }
+
+    IfxCan_Node_copyData(data, &element[2], IfxCan_dataLengthWords[r1.B.DLC]);
+
+    /* release the FIFO element, or the dedicated Rx buffer */
+    if (message->readFromRxFifo0)
+    {
+        IfxCan_Node_setRxFifo0AcknowledgeIndex(canNode, (IfxCan_RxBufferId)bufferId);
+    }
+    else if (message->readFromRxFifo1)
+    {
+        IfxCan_Node_setRxFifo1AcknowledgeIndex(canNode, (IfxCan_RxBufferId)bufferId);
+    }
+    else
+    {
+        IfxCan_Node_clearRxBufferNewDataFlag(canNode, (IfxCan_RxBufferId)bufferId);
+    }
+}
+
+
 IfxCan_Status IfxCan_Can_sendMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data)
 {
     IfxCan_Status     status   = IfxCan_Status_ok;
@@ -926,6 +1077,59 @@ IfxCan_Status IfxCan_Can_sendMessage(IfxCan_Can_Node *node, IfxCan_Message *mess
 }
 
 
+IfxCan_Status IfxCan_Can_sendMessageFast(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data)
+{
+    Ifx_CAN_N        *canNode = node->node;
+    IfxCan_Status     status  = IfxCan_Status_ok;
+    IfxCan_TxBufferId bufferId;
+    boolean           fdFrame = (message->frameMode != IfxCan_FrameMode_standard) ? TRUE : FALSE;
+
+    if (!message->storeInTxFifoQueue)
+    {
+        bufferId = (IfxCan_TxBufferId)message->bufferNumber;
+    }
+    else
+    {
+        bufferId = IfxCan_Node_getTxFifoQueuePutIndex(canNode);
+    }
+
+    if (IfxCan_Can_isTxBufferRequestPending(node, bufferId) == 1)
+    {
+        status = IfxCan_Status_notSentBusy;
+    }
+    else
+    {
+        uint32 *element;
+        uint32  t0, t1;
+
+        element = (uint32 *)IfxCan_Node_getTxBufferElementAddress(canNode, node->messageRAM.baseAddress, node->messageRAM.txBuffersStartAddress, bufferId);
+
+        /* header words built in registers, see Ifx_CAN_TXMSG_T0_Bits and Ifx_CAN_TXMSG_T1_Bits */
+        t0 = (message->messageId << ((message->messageIdLength != IfxCan_MessageIdLength_standard) ? 0 : 18)) & IFX_CAN_TXMSG_T0_ID_MSK;
+        t0 = t0 | ((message->remoteTransmitRequest ? 1U : 0U) << IFX_CAN_TXMSG_T0_RTR_OFF);
+        t0 = t0 | ((message->messageIdLength == IfxCan_MessageIdLength_extended) ? (1U << IFX_CAN_TXMSG_T0_XTD_OFF) : 0U);
+        t0 = t0 | ((fdFrame && message->errorStateIndicator) ? (1U << IFX_CAN_TXMSG_T0_ESI_OFF) : 0U);
+
+        t1 = ((uint32)message->dataLengthCode & IFX_CAN_TXMSG_T1_DLC_MSK) << IFX_CAN_TXMSG_T1_DLC_OFF;
+        t1 = t1 | (fdFrame ? (1U << IFX_CAN_TXMSG_T1_FDF_OFF) : 0U);
+        t1 = t1 | ((message->frameMode == IfxCan_FrameMode_fdLongAndFast) ? (1U << IFX_CAN_TXMSG_T1_BRS_OFF) : 0U);
+
+        if (message->txEventFifoControl == TRUE)
+        {
+            t1 = t1 | (1U << IFX_CAN_TXMSG_T1_EFC_OFF) | ((uint32)bufferId << IFX_CAN_TXMSG_T1_MM_OFF);
+        }
+
+        element[0] = t0;
+        element[1] = t1;
+        IfxCan_Node_copyData(&element[2], data, IfxCan_dataLengthWords[(uint32)message->dataLengthCode & 0xFU]);
+
+        IfxCan_Node_setTxBufferAddRequest(canNode, bufferId);
+    }
+
+    return status;
+}
+
+
 void IfxCan_Can_setExtendedFilter(IfxCan_Can_Node *node, IfxCan_Filter *filter)
 {
     /* get the Extended filter element address */
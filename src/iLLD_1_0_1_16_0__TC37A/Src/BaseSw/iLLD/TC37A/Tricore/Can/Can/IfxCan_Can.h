@@ -843,6 +843,47 @@ IFX_EXTERN void IfxCan_Can_initMessage(IfxCan_Message *message);
  */
 IFX_EXTERN void IfxCan_Can_readMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data);
 
+/** \brief Reads the CAN received message, fast path of \ref IfxCan_Can_readMessage()
+ *
+ * The two header words R0 and R1 are loaded once and decoded locally, instead of one message RAM
+ * access per field, and the data is copied with \ref IfxCan_Node_copyData().
+ * Additionally to \ref IfxCan_Can_readMessage(), remoteTransmitRequest and errorStateIndicator are returned.
+ * The new data flag is only cleared when reading a dedicated Rx buffer.
+ * \param node CAN Node handle
+ * \param message Structure for Message configuration, bufferNumber / readFromRxFifo0 / readFromRxFifo1 select the source
+ * \param data Pointer to data (in words), space for the DLC of the received frame
+ * \return None
+ */
+IFX_EXTERN void IfxCan_Can_readMessageFast(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data);
+
+/** \brief Reads up to maxCount messages from an Rx FIFO in one call
+ * \param node CAN Node handle
+ * \param fifo Rx FIFO to be read
+ * \param msgs Array of maxCount message structures, filled as by IfxCan_Can_readMessage()
+ * \param data Array of maxCount data slots. Each slot is the FIFO data field size in words (IfxCan_Node_getRxFifo0DataFieldSize() / 4),
+ * data of message i starts at data[i * slot size]
+ * \param maxCount Maximum number of messages to be read
+ * \return Number of messages read
+ *
+ * The FIFO status is read once, the elements present are decoded in order, and a single acknowledge
+ * of the last element read releases all of them.
+ *
+ * \code
+ *     IfxCan_Message msgs[8];
+ *     uint32         data[8 * 2];   // Rx FIFO 0 data field size: 8 bytes
+ *     uint32         i, count;
+ *
+ *     count = IfxCan_Can_readFifoBatch(&canNode[0], IfxCan_RxFifo_0, msgs, data, 8);
+ *
+ *     for (i = 0; i < count; i++)
+ *     {
+ *         handleMessage(&msgs[i], &data[i * 2]);
+ *     }
+ * \endcode
+ *
+ */
+IFX_EXTERN uint32 IfxCan_Can_readFifoBatch(IfxCan_Can_Node *node, IfxCan_RxFifo fifo, IfxCan_Message *msgs, uint32 *data, uint32 maxCount);
+
 /** \brief Transmits the CAN message
  * \param node CAN Node handle
  * \param message Structure for Message configuration. see IfxCan_Can_initMessage
@@ -854,6 +895,19 @@ IFX_EXTERN void IfxCan_Can_readMessage(IfxCan_Can_Node *node, IfxCan_Message *me
  */
 IFX_EXTERN IfxCan_Status IfxCan_Can_sendMessage(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data);
 
+/** \brief Transmits the CAN message, fast path of \ref IfxCan_Can_sendMessage()
+ *
+ * The header words T0 and T1 are built in registers and written with one store each, instead of a
+ * read-modify-write access per field, and the data is copied with \ref IfxCan_Node_copyData().
+ * As the complete header is written, the fields which are not requested (EFC, MM, ESI) are cleared,
+ * rather than left from the previous use of the Tx buffer.
+ * \param node CAN Node handle
+ * \param message Structure for Message configuration. see IfxCan_Can_initMessage
+ * \param data Pointer to data (in words)
+ * \return status
+ */
+IFX_EXTERN IfxCan_Status IfxCan_Can_sendMessageFast(IfxCan_Can_Node *node, IfxCan_Message *message, uint32 *data);
+
 /** \} */
 
 /** \addtogroup IfxLld_Can_Can_Filter_Configuration_Functions
@@ -49,6 +49,12 @@
 #include "IfxCan.h"
 #include "IfxCan_bf.h"
 
+/******************************************************************************/
+/*-----------------------Exported Variables/Constants-------------------------*/
+/******************************************************************************/
+
+IFX_CONST uint8 IfxCan_dataLengthWords[16] = {0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 4, 5, 6, 8, 12, 16};
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -72,22 +78,44 @@ void IfxCan_Node_clearRxBufferNewDataFlag(Ifx_CAN_N *node, IfxCan_RxBufferId rxB
 
 uint32 IfxCan_Node_getDataLength(IfxCan_DataLengthCode dataLengthCode)
 {
-    uint32 numBytes;
+    return IfxCan_dataLengthWords[(uint32)dataLengthCode & 0xFU];
+}
 
-    if (dataLengthCode <= IfxCan_DataLengthCode_8)
-    {
-        numBytes = (uint32)dataLengthCode;
-    }
-    else if (dataLengthCode <= IfxCan_DataLengthCode_24)
+
+void IfxCan_Node_copyData(uint32 *destination, const uint32 *source, uint32 length)
+{
+    uint32 w0, w1, w2, w3;
+
+    /* blocks of four words: loads grouped ahead of the stores */
+    while (length >= 4)
     {
-        numBytes = ((uint32)dataLengthCode - 6) << 2;
+        w0              = source[0];
+        w1              = source[1];
+        w2              = source[2];
+        w3              = source[3];
+        destination[0]  = w0;
+        destination[1]  = w1;
+        destination[2]  = w2;
+        destination[3]  = w3;
+        source         += 4;
+        destination    += 4;
+        length         -= 4;
     }
-    else
+
+    switch (length)
     {
-        numBytes = ((uint32)dataLengthCode - 11) << 4;
+    case 3:
+        destination[2] = source[2];
+    /* fall through */
+    case 2:
+        destination[1] = source[1];
+    /* fall through */
+    case 1:
+        destination[0] = source[0];
+        break;
+    default:
+        break;
     }
-
-    return (numBytes + 3) >> 2;
 }
 
 
@@ -371,16 +399,10 @@ boolean IfxCan_Node_isRxBufferNewDataUpdated(Ifx_CAN_N *node, IfxCan_RxBufferId
 
 void IfxCan_Node_readData(Ifx_CAN_RXMSG *rxBufferElement, IfxCan_DataLengthCode dataLengthCode, uint32 *data)
 {
-    uint32  i;
-    uint32 *destinationAddress = (uint32 *)rxBufferElement + 2;
-    /* get number of data bytes from data length code (DLC) */
-    uint32  length             = IfxCan_Node_getDataLength(dataLengthCode);
+    uint32 *sourceAddress = (uint32 *)rxBufferElement + 2;
 
     /* read data from the data section of Rx Buffer element  */
-    for (i = 0; i < length; i++)
-    {
-        data[i] = destinationAddress[i];
-    }
+    IfxCan_Node_copyData(data, sourceAddress, IfxCan_dataLengthWords[(uint32)dataLengthCode & 0xFU]);
 }
 
 
@@ -858,17 +880,10 @@ void IfxCan_Node_setInterruptLine(Ifx_CAN_N *node, IfxCan_Interrupt interrupt, I
 
 void IfxCan_Node_writeTxBufData(Ifx_CAN_TXMSG *txBufferElement, IfxCan_DataLengthCode dataLengthCode, uint32 *data)
 {
-    uint32  i;
-
     uint32 *destinationAddress = (uint32 *)txBufferElement + 2;
-    /* get number of data bytes from data length code (DLC) */
-    uint32  length             = IfxCan_Node_getDataLength(dataLengthCode);
 
     /* write data into the data section of Tx Buffer element  */
-    for (i = 0; i < length; i++)
-    {
-        destinationAddress[i] = data[i];
-    }
+    IfxCan_Node_copyData(destinationAddress, data, IfxCan_dataLengthWords[(uint32)dataLengthCode & 0xFU]);
 }
 
 
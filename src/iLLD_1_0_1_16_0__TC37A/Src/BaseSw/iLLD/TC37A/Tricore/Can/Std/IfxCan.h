@@ -379,6 +379,14 @@ typedef enum
     IfxCan_RxBufferId_63     /**< \brief Rx buffer 63  */
 } IfxCan_RxBufferId;
 
+/** \brief Rx FIFO selection
+ */
+typedef enum
+{
+    IfxCan_RxFifo_0,  /**< \brief Rx FIFO 0 */
+    IfxCan_RxFifo_1   /**< \brief Rx FIFO 1 */
+} IfxCan_RxFifo;
+
 /** \brief Rx FIFO 0/1 operating mode\n
  * Description in Ifx_CAN.N[x].RXFyC.FyOM, (x= 0 to 3; y = 0, 1)
  */
@@ -561,6 +569,14 @@ typedef struct
 
 /** \} */
 
+/******************************************************************************/
+/*-------------------Global Exported Variables/Constants----------------------*/
+/******************************************************************************/
+
+/** \brief Number of data words for each data length code (DLC), see \ref IfxCan_Node_getDataLength()
+ */
+IFX_EXTERN IFX_CONST uint8 IfxCan_dataLengthWords[16];
+
 /** \addtogroup IfxLld_Can_Std_Node_Functions
  * \{ */
 
@@ -688,6 +704,15 @@ IFX_INLINE IfxCan_DataLengthCode IfxCan_Node_getCodeFromDataLengthInBytes(uint32
  */
 IFX_EXTERN uint32 IfxCan_Node_getDataLength(IfxCan_DataLengthCode dataLengthCode);
 
+/** \brief Copies message data words between the message RAM and the application buffer.
+ * The copy is unrolled by four words, which covers the DLC word counts (0..6, 8, 12, 16) with at most one partial block
+ * \param destination Pointer to the destination words
+ * \param source Pointer to the source words
+ * \param length Number of words, see \ref IfxCan_dataLengthWords
+ * \return None
+ */
+IFX_EXTERN void IfxCan_Node_copyData(uint32 *destination, const uint32 *source, uint32 length);
+
 /** \brief Converts data length code (DLC) into number of data words.
  * This function is deprecated. Use new function IfxCan_Node_getDataLength
  * \param node Specifies the pointer to the CAN Node registers
@@ -60,6 +60,32 @@ IfxGeth_TxDescrList IfxGeth_Eth_txDescrList[IFXGETH_NUM_MODULES][IFXGETH_NUM_TX_
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+void *IfxGeth_Eth_allocRxBuffer(IfxGeth_Eth_RxBufferPool *pool)
+{
+    void  *buffer;
+    uint32 head, next, index;
+
+    do
+    {
+        buffer = NULL_PTR;
+        head   = pool->head;
+        index  = head & IFXGETH_ETH_RXBUFFERPOOL_EMPTY;
+
+        if (index == IFXGETH_ETH_RXBUFFERPOOL_EMPTY)
+        {
+            break;
+        }
+
+        /* the link is stale if another context took the buffer meanwhile, the changed tag then fails the swap */
+        buffer = &pool->buffers[index * pool->bufferSize];
+        next   = *(volatile uint32 *)buffer;
+        next   = ((head + 0x10000U) & ~(uint32)IFXGETH_ETH_RXBUFFERPOOL_EMPTY) | (next & IFXGETH_ETH_RXBUFFERPOOL_EMPTY);
+    } while (__cmpAndSwap((unsigned int *)&pool->head, next, head) != head);
+
+    return buffer;
+}
+
+
 void IfxGeth_Eth_configureDMA(IfxGeth_Eth *geth, IfxGeth_Eth_DmaConfig *dmaConfig)
 {
     uint32 txChannelIndex, rxChannelIndex, channelIndex;
@@ -574,14 +600,38 @@ void IfxGeth_Eth_initModuleConfig(IfxGeth_Eth_Config *config, Ifx_GETH *gethSFR)
 }
 
 
+void IfxGeth_Eth_initRxBufferPool(IfxGeth_Eth_RxBufferPool *pool, void *buffers, uint16 bufferSize, uint16 count)
+{
+    uint32 i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)buffers % 4) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (bufferSize % 4) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count < IFXGETH_ETH_RXBUFFERPOOL_EMPTY);
+
+    pool->buffers    = (uint8 *)buffers;
+    pool->bufferSize = bufferSize;
+    pool->count      = count;
+
+    /* free list linked through the first word of each buffer */
+    for (i = 0; i < count; i++)
+    {
+        *(uint32 *)&pool->buffers[i * bufferSize] = ((i + 1) < count) ? (i + 1) : IFXGETH_ETH_RXBUFFERPOOL_EMPTY;
+    }
+
+    pool->head = (count != 0) ? 0 : IFXGETH_ETH_RXBUFFERPOOL_EMPTY;
+}
+
+
 void IfxGeth_Eth_initReceiveDescriptors(IfxGeth_Eth *geth, IfxGeth_Eth_RxChannelConfig *config)
 {
     int                       i;
     uint32                    buffer1StartAddress = (uint32)config->rxBuffer1StartAddress;
 
     IfxGeth_RxDmaChannel      channelId           = config->channelId;
-    geth->rxChannel[channelId].channelId   = channelId;
-    geth->rxChannel[channelId].rxDescrList = config->rxDescrList;
+    geth->rxChannel[channelId].channelId    = channelId;
+    geth->rxChannel[channelId].rxDescrList  = config->rxDescrList;
+    geth->rxChannel[channelId].rxBufferPool = NULL_PTR;
+    geth->rxChannel[channelId].refillCount  = 0;
 
     volatile IfxGeth_RxDescr *descr = IfxGeth_Eth_getBaseRxDescriptor(geth, channelId);
 
@@ -649,19 +699,219 @@ void IfxGeth_Eth_initTransmitDescriptors(IfxGeth_Eth *geth, IfxGeth_Eth_TxChanne
     }
 
     /* rest the current pointer to base pointer in the handle */
-    geth->txChannel[channelId].txDescrPtr = IfxGeth_Eth_getBaseTxDescriptor(geth, channelId);
+    geth->txChannel[channelId].txDescrPtr      = IfxGeth_Eth_getBaseTxDescriptor(geth, channelId);
+    geth->txChannel[channelId].reclaimDescrPtr = IfxGeth_Eth_getBaseTxDescriptor(geth, channelId);
+    geth->txChannel[channelId].queuedCount     = 0;
+    geth->txChannel[channelId].reclaimedCount  = 0;
+    geth->txChannel[channelId].txErrorCount    = 0;
 
     IfxGeth_dma_setTxDescriptorListAddress(geth->gethSFR, channelId, (uint32)IfxGeth_Eth_getBaseTxDescriptor(geth, channelId));
     IfxGeth_dma_setTxDescriptorRingLength(geth->gethSFR, channelId, (IFXGETH_MAX_TX_DESCRIPTORS - 1));
 }
 
 
+void *IfxGeth_Eth_loanReceiveBuffer(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId, uint32 *length)
+{
+    IfxGeth_Eth_RxChannel    *channel = &geth->rxChannel[channelId];
+    volatile IfxGeth_RxDescr *base    = IfxGeth_Eth_getBaseRxDescriptor(geth, channelId);
+    void                     *result  = NULL_PTR;
+
+    /* the descriptors waiting for a buffer are not owned by the DMA, but hold no frame */
+    while ((result == NULL_PTR) && (channel->refillCount < IFXGETH_MAX_RX_DESCRIPTORS) && (channel->rxDescrPtr->RDES3.R.OWN == 0))
+    {
+        uint32           index  = (uint32)(channel->rxDescrPtr - base);
+        void            *buffer = channel->rxBuffer[index];
+        IfxGeth_RxDescr3 rdes3;
+        rdes3.U = channel->rxDescrPtr->RDES3.U;
+
+        channel->rxBuffer[index] = NULL_PTR;
+        channel->refillCount++;
+        IfxGeth_Eth_shuffleRxDescriptor(geth, channelId);
+
+        if ((rdes3.W.FD == 1) && (rdes3.W.LD == 1) && (rdes3.W.ES == 0) && (rdes3.W.CTXT == 0))
+        {
+            channel->rxCount++;
+            *length = rdes3.W.PL;
+            result  = buffer;
+        }
+        else
+        {
+            /* error, or frame spread over several buffers */
+            channel->rxDropCount++;
+            IfxGeth_Eth_releaseRxBuffer(channel->rxBufferPool, buffer);
+        }
+    }
+
+    IfxGeth_Eth_refillReceiveDescriptors(geth, channelId);
+    IfxGeth_Eth_wakeupReceiver(geth, channelId);
+
+    return result;
+}
+
+
+uint32 IfxGeth_Eth_reclaimTransmitDescriptors(IfxGeth_Eth *geth, IfxGeth_TxDmaChannel channelId, void **buffers, uint32 maxCount)
+{
+    IfxGeth_Eth_TxChannel    *channel = &geth->txChannel[channelId];
+    volatile IfxGeth_TxDescr *base    = IfxGeth_Eth_getBaseTxDescriptor(geth, channelId);
+    volatile IfxGeth_TxDescr *descr   = channel->reclaimDescrPtr;
+    uint32                    count   = 0;
+    IfxGeth_TxDescr3          tdes3;
+
+    /* only the descriptors queued by IfxGeth_Eth_sendFrames() and not reclaimed yet */
+    maxCount = __minu(maxCount, channel->queuedCount - channel->reclaimedCount);
+
+    while (count < maxCount)
+    {
+        tdes3.U = descr->TDES3.U;
+
+        if (tdes3.W.OWN == 1)
+        {
+            break;
+        }
+
+        if (tdes3.W.ES == 1)
+        {
+            channel->txErrorCount++;
+        }
+
+        if (buffers != NULL_PTR)
+        {
+            buffers[count] = channel->txBuffer[descr - base];
+        }
+
+        /* point to the next descriptor, wrap around the descriptors */
+        descr = (descr == &base[IFXGETH_MAX_TX_DESCRIPTORS - 1]) ? base : &descr[1];
+        count++;
+    }
+
+    channel->reclaimDescrPtr = descr;
+    channel->reclaimedCount += count; /* descriptors handed over to IfxGeth_Eth_sendFrames() */
+
+    return count;
+}
+
+
+uint32 IfxGeth_Eth_refillReceiveDescriptors(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId)
+{
+    IfxGeth_Eth_RxChannel    *channel = &geth->rxChannel[channelId];
+    volatile IfxGeth_RxDescr *base    = IfxGeth_Eth_getBaseRxDescriptor(geth, channelId);
+    uint32                    count   = 0;
+    IfxGeth_RxDescr3          rdes3;
+
+    rdes3.U       = 0;
+    rdes3.R.BUF1V = 1;      /* buffer 1 valid */
+    rdes3.R.BUF2V = 0;      /* buffer 2 not valid */
+    rdes3.R.IOC   = 1;      /* interrupt enabled */
+    rdes3.R.OWN   = 1;      /* owned by DMA */
+
+    while (channel->refillCount > 0)
+    {
+        volatile IfxGeth_RxDescr *descr  = channel->refillDescrPtr;
+        void                     *buffer = IfxGeth_Eth_allocRxBuffer(channel->rxBufferPool);
+
+        if (buffer == NULL_PTR)
+        {
+            break;
+        }
+
+        channel->rxBuffer[descr - base] = buffer;
+        descr->RDES0.U                  = (uint32)buffer;
+        descr->RDES1.U                  = 0;
+        descr->RDES2.U                  = 0; /* buffer2 not used */
+        descr->RDES3.U                  = rdes3.U;
+
+        /* point to the next descriptor, wrap around the descriptors */
+        channel->refillDescrPtr = (descr == &base[IFXGETH_MAX_RX_DESCRIPTORS - 1]) ? base : &descr[1];
+        channel->refillCount--;
+        count++;
+    }
+
+    return count;
+}
+
+
+void IfxGeth_Eth_releaseRxBuffer(IfxGeth_Eth_RxBufferPool *pool, void *buffer)
+{
+    uint32 index = (uint32)((uint8 *)buffer - pool->buffers) / pool->bufferSize;
+    uint8 *start = &pool->buffers[index * pool->bufferSize];
+    uint32 head, next;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, index < pool->count);
+
+    do
+    {
+        head                      = pool->head;
+        *(volatile uint32 *)start = head & IFXGETH_ETH_RXBUFFERPOOL_EMPTY;
+        next                      = ((head + 0x10000U) & ~(uint32)IFXGETH_ETH_RXBUFFERPOOL_EMPTY) | index;
+    } while (__cmpAndSwap((unsigned int *)&pool->head, next, head) != head);
+}
+
+
+void IfxGeth_Eth_returnReceiveBuffer(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId, void *buffer)
+{
+    IfxGeth_Eth_releaseRxBuffer(geth->rxChannel[channelId].rxBufferPool, buffer);
+}
+
+
 void IfxGeth_Eth_sendFrame(IfxGeth_Eth *geth, IfxGeth_Eth_FrameConfig *config)
 {
     IfxGeth_Eth_sendTransmitBuffer(geth, config->packetLength, config->channelId);
 }
 
 
+uint32 IfxGeth_Eth_sendFrames(IfxGeth_Eth *geth, const IfxGeth_Eth_TxFrame *frames, uint32 count, IfxGeth_TxDmaChannel channelId)
+{
+    IfxGeth_Eth_TxChannel    *channel = &geth->txChannel[channelId];
+    volatile IfxGeth_TxDescr *base    = IfxGeth_Eth_getBaseTxDescriptor(geth, channelId);
+    volatile IfxGeth_TxDescr *descr   = channel->txDescrPtr;
+    uint32                    i;
+    IfxGeth_TxDescr2          tdes2;
+    IfxGeth_TxDescr3          tdes3;
+
+    /* back-pressure: one descriptor is kept free, so that the tail pointer never equals the current descriptor of the DMA */
+    count = __minu(count, (IFXGETH_MAX_TX_DESCRIPTORS - 1) - (channel->queuedCount - channel->reclaimedCount));
+
+    for (i = 0; i < count; i++)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (frames[i].length > 0) && (frames[i].length <= 0x3FFFU));
+
+        tdes2.U         = 0;
+        tdes2.R.B1L     = frames[i].length;
+        tdes2.R.IOC     = (i == (count - 1)) ? 1 : 0; /* one interrupt for the whole batch */
+
+        tdes3.U         = 0;
+        tdes3.R.FL_TPL  = frames[i].length;           /* total length of the packet */
+        tdes3.R.CIC_TPL = 3;
+        tdes3.R.LD      = 1;                          /* each frame on a single descriptor */
+        tdes3.R.FD      = 1;
+        tdes3.R.OWN     = 1;                          /* release to DMA */
+
+        channel->txBuffer[descr - base] = frames[i].buffer;
+        descr->TDES0.U                  = (uint32)frames[i].buffer;
+        descr->TDES1.U                  = 0;          /* buffer2 not used */
+        descr->TDES2.U                  = tdes2.U;
+        descr->TDES3.U                  = tdes3.U;    /* OWN written last */
+
+        /* point to the next descriptor, wrap around the descriptors */
+        descr = (descr == &base[IFXGETH_MAX_TX_DESCRIPTORS - 1]) ? base : &descr[1];
+    }
+
+    if (count > 0)
+    {
+        channel->txDescrPtr   = descr;
+        channel->queuedCount += count;
+        channel->txCount     += count;
+
+        /* descriptors written before the DMA is started, once for the whole batch */
+        __dsync();
+        IfxGeth_dma_setTxDescriptorTailPointer(geth->gethSFR, channelId, (uint32)descr);
+        IfxGeth_Eth_wakeupTransmitter(geth, channelId);
+    }
+
+    return count;
+}
+
+
 void IfxGeth_Eth_sendTransmitBuffer(IfxGeth_Eth *geth, uint32 packetLength, IfxGeth_TxDmaChannel channelId)
 {
     uint32                    i;
@@ -720,6 +970,30 @@ void IfxGeth_Eth_sendTransmitBuffer(IfxGeth_Eth *geth, uint32 packetLength, IfxG
 }
 
 
+void IfxGeth_Eth_setRxBufferPool(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId, IfxGeth_Eth_RxBufferPool *pool)
+{
+    IfxGeth_Eth_RxChannel    *channel = &geth->rxChannel[channelId];
+    volatile IfxGeth_RxDescr *descr   = IfxGeth_Eth_getBaseRxDescriptor(geth, channelId);
+    uint32                    i;
+
+    /* all descriptors are taken back from the DMA, and wait for a buffer from the pool */
+    for (i = 0; i < IFXGETH_MAX_RX_DESCRIPTORS; i++)
+    {
+        descr[i].RDES3.U     = 0;
+        channel->rxBuffer[i] = NULL_PTR;
+    }
+
+    channel->rxBufferPool   = pool;
+    channel->rxDescrPtr     = descr;
+    channel->refillDescrPtr = descr;
+    channel->refillCount    = IFXGETH_MAX_RX_DESCRIPTORS;
+    channel->rxDropCount    = 0;
+
+    IfxGeth_dma_setRxBufferSize(geth->gethSFR, channelId, pool->bufferSize);
+    IfxGeth_Eth_refillReceiveDescriptors(geth, channelId);
+}
+
+
 void IfxGeth_Eth_setupMiiInputPins(IfxGeth_Eth *geth, const IfxGeth_Eth_MiiPins *miiPins)
 {
     IfxPort_InputMode mode       = IfxPort_InputMode_noPullDevice;
@@ -192,6 +192,48 @@
  * // data is available in pRxBuf
  * \endcode
  *
+ * \subsection  IfxLld_Geth_Eth_DataTransfers_ZeroCopyReceive Zero-copy Receive
+ * Instead of the fixed buffers of the Rx descriptor list, the descriptors can be refilled from a pool of
+ * packet buffers. Each received buffer is then loaned to the application (e.g. to the TCP/IP stack), and given
+ * back to the pool when it is no longer used; the pool may hold more buffers than descriptors.
+ * \code
+ * IfxGeth_Eth_RxBufferPool rxPool;
+ * uint32 rxPoolBuffers[32][1536 / 4];
+ *
+ * // after IfxGeth_Eth_initModule()
+ * IfxGeth_Eth_initRxBufferPool(&rxPool, rxPoolBuffers, sizeof(rxPoolBuffers[0]), 32);
+ * IfxGeth_Eth_setRxBufferPool(&geth, IfxGeth_RxDmaChannel_0, &rxPool);
+ * IfxGeth_Eth_startReceiver(&geth, IfxGeth_RxDmaChannel_0);
+ *
+ * // receive
+ * uint32 length;
+ * uint8 *pRxBuf = (uint8*)IfxGeth_Eth_loanReceiveBuffer(&geth, IfxGeth_RxDmaChannel_0, &length);
+ *
+ * if (pRxBuf != NULL_PTR)
+ * {
+ *     // data is available in pRxBuf until it is given back, from any context
+ *     IfxGeth_Eth_returnReceiveBuffer(&geth, IfxGeth_RxDmaChannel_0, pRxBuf);
+ * }
+ * \endcode
+ *
+ * \subsection  IfxLld_Geth_Eth_DataTransfers_BatchTransmit Batch Transmission
+ * Frames prepared by the application in its own buffers can be queued several at a time. The tail pointer
+ * is written and the transmitter woken up once per call, and the descriptors are reclaimed in bulk,
+ * typically from the Tx interrupt which is requested by the last frame of each call.
+ * \code
+ * IfxGeth_Eth_TxFrame frames[8];
+ * uint32 queued;
+ *
+ * // ... frames[i].buffer and frames[i].length set to complete frames
+ * queued = IfxGeth_Eth_sendFrames(&geth, frames, 8, IfxGeth_TxDmaChannel_0);
+ *
+ * // frames from queued on were not accepted, the descriptors are still owned by the DMA: retry later
+ *
+ * // Tx interrupt: hand the buffers of the transmitted frames back
+ * void  *done[IFXGETH_MAX_TX_DESCRIPTORS];
+ * uint32 n = IfxGeth_Eth_reclaimTransmitDescriptors(&geth, IfxGeth_TxDmaChannel_0, done, IFXGETH_MAX_TX_DESCRIPTORS);
+ * \endcode
+ *
  * \subsection  IfxLld_Geth_Eth_DataTransfers_GiantFrame Giant Frame Transmission
  * Giant frames are supported by ethernet driver.
  * By default any frames greater than 1518 bytes are considered as giant frames in the code.
@@ -255,6 +297,14 @@
 #include "IfxPort_reg.h"
 #include "IfxPort_bf.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Index marking the end of the free list of an \ref IfxGeth_Eth_RxBufferPool
+ */
+#define IFXGETH_ETH_RXBUFFERPOOL_EMPTY (0xFFFFU)
+
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
@@ -339,6 +389,20 @@ typedef struct
     IfxGeth_Txen_Out   *txEn;         /**< \brief Pointer to TXEN output pin config */
 } IfxGeth_Eth_RmiiPins;
 
+/** \brief Pool of Rx packet buffers, see \ref IfxGeth_Eth_initRxBufferPool()
+ *
+ * The free buffers form a LIFO list linked through their first word. head holds the index of the
+ * first free buffer in the lower 16 bits and a tag, incremented on each change, in the upper 16 bits,
+ * so that buffers can be taken and given back with a compare and swap from any context.
+ */
+typedef struct
+{
+    uint8          *buffers;          /**< \brief Start address of the buffers, count * bufferSize bytes, word aligned */
+    uint16          bufferSize;       /**< \brief Size of one buffer in bytes, multiple of 4 */
+    uint16          count;            /**< \brief Number of buffers */
+    volatile uint32 head;             /**< \brief (tag << 16) | index of the first free buffer, \ref IFXGETH_ETH_RXBUFFERPOOL_EMPTY if none */
+} IfxGeth_Eth_RxBufferPool;
+
 /** \brief Configuration sturcture for DMA rx channel
  */
 typedef struct
@@ -440,21 +504,31 @@ typedef struct
  */
 typedef struct
 {
-    IfxGeth_RxDmaChannel      channelId;         /**< \brief Rx DMA channel Index */
-    IfxGeth_RxDescrList      *rxDescrList;       /**< \brief pointer to RX descriptors RAM */
-    volatile IfxGeth_RxDescr *rxDescrPtr;        /**< \brief Pointer to Rx Descriptor (current descriptor) */
-    uint32                    rxCount;           /**< \brief Number of frames received */
+    IfxGeth_RxDmaChannel      channelId;                              /**< \brief Rx DMA channel Index */
+    IfxGeth_RxDescrList      *rxDescrList;                            /**< \brief pointer to RX descriptors RAM */
+    volatile IfxGeth_RxDescr *rxDescrPtr;                             /**< \brief Pointer to Rx Descriptor (current descriptor) */
+    uint32                    rxCount;                                /**< \brief Number of frames received */
+    IfxGeth_Eth_RxBufferPool *rxBufferPool;                           /**< \brief Pool the descriptors are refilled from, NULL_PTR if the channel uses fixed buffers */
+    volatile IfxGeth_RxDescr *refillDescrPtr;                         /**< \brief Next descriptor to be given a buffer from the pool */
+    uint32                    refillCount;                            /**< \brief Number of descriptors waiting for a buffer from the pool */
+    uint32                    rxDropCount;                            /**< \brief Number of buffers dropped by \ref IfxGeth_Eth_loanReceiveBuffer(), errors and parts of split frames */
+    void                     *rxBuffer[IFXGETH_MAX_RX_DESCRIPTORS];   /**< \brief Buffer given to each descriptor, as RDES0 is overwritten by the write-back */
 } IfxGeth_Eth_RxChannel;
 
 /** \brief handle sturcture for DMA tx channel
  */
 typedef struct
 {
-    IfxGeth_TxDmaChannel      channelId;         /**< \brief Tx DMA channel Index */
-    IfxGeth_TxDescrList      *txDescrList;       /**< \brief pointer to TX descriptors RAM */
-    volatile IfxGeth_TxDescr *txDescrPtr;        /**< \brief Pointer to Tx Descriptor (current descriptor) */
-    uint32                    txCount;           /**< \brief Number of frames transmitted */
-    uint16                    txBuf1Size;        /**< \brief configured tx buffer 1 size */
+    IfxGeth_TxDmaChannel      channelId;                              /**< \brief Tx DMA channel Index */
+    IfxGeth_TxDescrList      *txDescrList;                            /**< \brief pointer to TX descriptors RAM */
+    volatile IfxGeth_TxDescr *txDescrPtr;                             /**< \brief Pointer to Tx Descriptor (current descriptor) */
+    uint32                    txCount;                                /**< \brief Number of frames transmitted */
+    uint16                    txBuf1Size;                             /**< \brief configured tx buffer 1 size */
+    volatile IfxGeth_TxDescr *reclaimDescrPtr;                        /**< \brief Next descriptor to be reclaimed by \ref IfxGeth_Eth_reclaimTransmitDescriptors() */
+    volatile uint32           queuedCount;                            /**< \brief Number of descriptors given to the DMA by \ref IfxGeth_Eth_sendFrames(), wraps around */
+    volatile uint32           reclaimedCount;                         /**< \brief Number of descriptors reclaimed, wraps around */
+    uint32                    txErrorCount;                           /**< \brief Number of reclaimed frames with the error summary set */
+    void                     *txBuffer[IFXGETH_MAX_TX_DESCRIPTORS];   /**< \brief Frame buffer given to each descriptor, as TDES0 is overwritten by the write-back */
 } IfxGeth_Eth_TxChannel;
 
 /** \} */
@@ -496,6 +570,14 @@ typedef struct
     uint32               packetLength;       /**< \brief the length of the packet to be transmitted in bytes */
 } IfxGeth_Eth_FrameConfig;
 
+/** \brief Frame to be transmitted by \ref IfxGeth_Eth_sendFrames()
+ */
+typedef struct
+{
+    void  *buffer;       /**< \brief Start address of the complete frame, including the header */
+    uint16 length;       /**< \brief Length of the frame in bytes, without FCS */
+} IfxGeth_Eth_TxFrame;
+
 /** \addtogroup IfxLld_Geth_Eth_MAC_Functions
  * \{ */
 
@@ -885,6 +967,55 @@ IFX_EXTERN void IfxGeth_Eth_sendFrame(IfxGeth_Eth *geth, IfxGeth_Eth_FrameConfig
  */
 IFX_EXTERN void IfxGeth_Eth_sendTransmitBuffer(IfxGeth_Eth *geth, uint32 packetLength, IfxGeth_TxDmaChannel channelId);
 
+/** \brief Queues several frames on consecutive Tx descriptors, and starts the DMA once for all of them.
+ *
+ * Each frame is transmitted from its own buffer, without copy, on a single descriptor. The buffers shall not
+ * be changed until they are handed back by \ref IfxGeth_Eth_reclaimTransmitDescriptors().
+ * Never waits: when the descriptors are still owned by the DMA or not reclaimed yet, only the first frames are queued.
+ * One descriptor of the ring is kept free, so that the tail pointer never reaches the current descriptor of the DMA.
+ * Only the last descriptor of the call requests an interrupt on completion.
+ * Not to be mixed with \ref IfxGeth_Eth_sendTransmitBuffer() on the same channel.
+ * \param geth GETH driver Handle
+ * \param frames Frames to be transmitted, in order
+ * \param count Number of frames
+ * \param channelId Tx channel Id
+ * \return Number of frames queued, from the start of frames
+ *
+ * \code
+ * // IfxGeth_Eth geth; // assumed to be defined globally
+ * IfxGeth_Eth_TxFrame frames[4];
+ * void  *done[IFXGETH_MAX_TX_DESCRIPTORS];
+ * uint32 i, n, sent = 0;
+ *
+ * // ... frames[i].buffer and frames[i].length set to complete frames
+ *
+ * while (sent < 4)
+ * {
+ *     // give the buffers of the transmitted frames back to the application
+ *     n = IfxGeth_Eth_reclaimTransmitDescriptors(&geth, IfxGeth_TxDmaChannel_0, done, IFXGETH_MAX_TX_DESCRIPTORS);
+ *
+ *     for (i = 0; i < n; i++)
+ *     {
+ *         freeLogBuffer(done[i]);
+ *     }
+ *
+ *     sent += IfxGeth_Eth_sendFrames(&geth, &frames[sent], 4 - sent, IfxGeth_TxDmaChannel_0);
+ * }
+ * \endcode
+ *
+ */
+IFX_EXTERN uint32 IfxGeth_Eth_sendFrames(IfxGeth_Eth *geth, const IfxGeth_Eth_TxFrame *frames, uint32 count, IfxGeth_TxDmaChannel channelId);
+
+/** \brief Reclaims all the descriptors of \ref IfxGeth_Eth_sendFrames() the DMA is done with, in order.
+ * May be called from another context than \ref IfxGeth_Eth_sendFrames() (e.g. the Tx interrupt), but from a single one per channel.
+ * \param geth GETH driver Handle
+ * \param channelId Tx channel Id
+ * \param buffers Returns the buffers of the transmitted frames, may be NULL_PTR
+ * \param maxCount Maximum number of descriptors to reclaim, size of buffers
+ * \return Number of descriptors reclaimed
+ */
+IFX_EXTERN uint32 IfxGeth_Eth_reclaimTransmitDescriptors(IfxGeth_Eth *geth, IfxGeth_TxDmaChannel channelId, void **buffers, uint32 maxCount);
+
 /** \brief Updates the current Rx descriptor pointer in the handle to next Rx descriptor
  * \param geth GETH driver Handle
  * \param channelId Rx channel Id
@@ -1062,6 +1193,92 @@ IFX_INLINE volatile IfxGeth_TxDescr *IfxGeth_Eth_getBaseTxDescriptor(IfxGeth_Eth
  *
  */
 IFX_EXTERN void IfxGeth_Eth_freeReceiveBuffer(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId);
+
+/** \brief Initialises a pool of Rx packet buffers
+ * \param pool Pool to be initialised
+ * \param buffers Start address of the buffers, count * bufferSize bytes, word aligned
+ * \param bufferSize Size of one buffer in bytes, multiple of 4, large enough for a complete frame
+ * \param count Number of buffers, may be larger than \ref IFXGETH_MAX_RX_DESCRIPTORS to cover the buffers on loan
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_Eth_initRxBufferPool(IfxGeth_Eth_RxBufferPool *pool, void *buffers, uint16 bufferSize, uint16 count);
+
+/** \brief Takes a free buffer from the pool.
+ * Lock-free, may be called from any context.
+ * \param pool Pool of Rx packet buffers
+ * \return Pointer to the buffer, NULL_PTR if the pool is empty
+ */
+IFX_EXTERN void *IfxGeth_Eth_allocRxBuffer(IfxGeth_Eth_RxBufferPool *pool);
+
+/** \brief Gives a buffer back to the pool.
+ * Lock-free, may be called from any context.
+ * \param pool Pool of Rx packet buffers
+ * \param buffer Pointer into the buffer, e.g. the payload pointer after the headers were removed
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_Eth_releaseRxBuffer(IfxGeth_Eth_RxBufferPool *pool, void *buffer);
+
+/** \brief Switches the Rx channel to buffers from the pool, and gives a buffer to each descriptor.
+ * To be called after \ref IfxGeth_Eth_initModule() and before the receiver is started.
+ * The DMA buffer size is set to the size of the pool buffers.
+ * \param geth GETH driver Handle
+ * \param channelId Rx channel Id
+ * \param pool Pool of Rx packet buffers
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_Eth_setRxBufferPool(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId, IfxGeth_Eth_RxBufferPool *pool);
+
+/** \brief Returns the buffer of the next received frame and hands it over to the caller, without copy.
+ *
+ * The descriptor is given a new buffer from the pool, the received one stays valid until it is given
+ * back with \ref IfxGeth_Eth_returnReceiveBuffer(). Frames with errors and frames which do not fit a single
+ * buffer are dropped and counted in rxDropCount.
+ * To be called from a single context per channel (e.g. the Rx interrupt or the Rx task).
+ * \param geth GETH driver Handle
+ * \param channelId Rx channel Id
+ * \param length Returns the frame length in bytes, including the FCS if not stripped
+ * \return Pointer to the frame, NULL_PTR if no frame is available
+ *
+ * \code
+ * // lwIP: the frame is passed to the stack as a custom pbuf referencing the buffer
+ * static void freeRxPbuf(struct pbuf *p)
+ * {
+ *     IfxGeth_Eth_returnReceiveBuffer(&geth, IfxGeth_RxDmaChannel_0, ((struct pbuf_custom *)p)->pbuf.payload);
+ *     // ... give the pbuf_custom back to its own pool
+ * }
+ *
+ * uint32 length;
+ * uint8 *frame;
+ *
+ * while ((frame = IfxGeth_Eth_loanReceiveBuffer(&geth, IfxGeth_RxDmaChannel_0, &length)) != NULL_PTR)
+ * {
+ *     struct pbuf_custom *pc = allocPbufCustom();
+ *     pc->custom_free_function = freeRxPbuf;
+ *     netif->input(pbuf_alloced_custom(PBUF_RAW, length, PBUF_REF, pc, frame, length), netif);
+ * }
+ * \endcode
+ *
+ */
+IFX_EXTERN void *IfxGeth_Eth_loanReceiveBuffer(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId, uint32 *length);
+
+/** \brief Gives a buffer returned by \ref IfxGeth_Eth_loanReceiveBuffer() back to the pool of the channel.
+ * Lock-free, may be called from any context. The descriptors are refilled by the next
+ * \ref IfxGeth_Eth_loanReceiveBuffer() or \ref IfxGeth_Eth_refillReceiveDescriptors().
+ * \param geth GETH driver Handle
+ * \param channelId Rx channel Id
+ * \param buffer Pointer into the buffer
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_Eth_returnReceiveBuffer(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId, void *buffer);
+
+/** \brief Gives a buffer from the pool to each descriptor waiting for one, in ring order.
+ * To be called from the context of \ref IfxGeth_Eth_loanReceiveBuffer(), e.g. when the pool ran empty;
+ * followed by \ref IfxGeth_Eth_wakeupReceiver() if the receiver may have stopped on a missing buffer.
+ * \param geth GETH driver Handle
+ * \param channelId Rx channel Id
+ * \return Number of descriptors given back to the DMA
+ */
+IFX_EXTERN uint32 IfxGeth_Eth_refillReceiveDescriptors(IfxGeth_Eth *geth, IfxGeth_RxDmaChannel channelId);
 /** \addtogroup IfxLld_Geth_Eth_Variables
  * \{ */
 
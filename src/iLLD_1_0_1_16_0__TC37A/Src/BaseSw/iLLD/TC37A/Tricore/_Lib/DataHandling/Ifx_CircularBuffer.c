@@ -92,22 +92,100 @@ void Ifx_CircularBuffer_addDataIncr(Ifx_CircularBuffer *buffer, uint32 data)
 }
 
 
-void *Ifx_CircularBuffer_read8(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
+/** \brief Copy count bytes from source to dest
+ *
+ * When source and dest have the same alignment, the bulk of the data is moved with
+ * aligned 32 bit accesses, 64 bit per iteration. Else the data is moved byte per byte.
+ */
+static void Ifx_CircularBuffer_copy8(uint8 *dest, const uint8 *source, Ifx_SizeT count)
 {
-    uint8 *Dest = (uint8 *)data;
+    if (((((uint32)dest) ^ ((uint32)source)) & 3U) == 0)
+    {
+        uint32       *dest32;
+        const uint32 *source32;
+
+        while ((count > 0) && ((((uint32)dest) & 3U) != 0))
+        {
+            *dest  = *source;
+            dest   = &dest[1];
+            source = &source[1];
+            count--;
+        }
+
+        dest32   = (uint32 *)dest;
+        source32 = (const uint32 *)source;
+
+        while (count >= 8)
+        {
+            dest32[0] = source32[0];
+            dest32[1] = source32[1];
+            dest32    = &dest32[2];
+            source32  = &source32[2];
+            count    -= 8;
+        }
 
-    do
+        if (count >= 4)
+        {
+            *dest32  = *source32;
+            dest32   = &dest32[1];
+            source32 = &source32[1];
+            count   -= 4;
+        }
+
+        dest   = (uint8 *)dest32;
+        source = (const uint8 *)source32;
+    }
+
+    while (count > 0)
     {
+        *dest  = *source;
+        dest   = &dest[1];
+        source = &source[1];
         count--;
-        *Dest = ((uint8 *)buffer->base)[buffer->index];
-        Dest  = &Dest[1];
-        buffer->index++;
+    }
+}
+
+
+/** \brief Copy count 32 bit words from source to dest, 64 bit per iteration
+ */
+static void Ifx_CircularBuffer_copy32(uint32 *dest, const uint32 *source, Ifx_SizeT count)
+{
+    while (count >= 2)
+    {
+        dest[0] = source[0];
+        dest[1] = source[1];
+        dest    = &dest[2];
+        source  = &source[2];
+        count  -= 2;
+    }
+
+    if (count > 0)
+    {
+        *dest = *source;
+    }
+}
+
+
+void *Ifx_CircularBuffer_read8(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
+{
+    uint8    *Dest = (uint8 *)data;
+    uint8    *base = buffer->base;
+    Ifx_SizeT blockSize;
+
+    /* Copy up to the end of the buffer, then wrap around as often as count requires */
+    while (count > 0)
+    {
+        blockSize     = __min(count, buffer->length - buffer->index);
+        Ifx_CircularBuffer_copy8(Dest, &base[buffer->index], blockSize);
+        Dest          = &Dest[blockSize];
+        count        -= blockSize;
+        buffer->index = (uint16)(buffer->index + blockSize);
 
         if (buffer->index >= buffer->length)
         {
             buffer->index = 0;
         }
-    } while (count > 0);
+    }
 
     return Dest;
 }
@@ -115,22 +193,24 @@ void *Ifx_CircularBuffer_read8(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT
 
 void *Ifx_CircularBuffer_read32(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
 {
-    uint32 *Dest = (uint32 *)data;
-    uint8  *base = buffer->base;
+    uint32   *Dest = (uint32 *)data;
+    uint8    *base = buffer->base;
+    Ifx_SizeT blockSize;
 
-    do
+    /* Copy up to the end of the buffer, then wrap around as often as count requires */
+    while (count > 0)
     {
-        *Dest         = *((uint32 *)(&base[buffer->index]));
-        Dest          = &Dest[1];
-        buffer->index = buffer->index + 4;
+        blockSize     = __min(count, (buffer->length - buffer->index + 3) / 4);
+        Ifx_CircularBuffer_copy32(Dest, (uint32 *)(&base[buffer->index]), blockSize);
+        Dest          = &Dest[blockSize];
+        count        -= blockSize;
+        buffer->index = (uint16)(buffer->index + (blockSize * 4));
 
         if (buffer->index >= buffer->length)
         {
             buffer->index = 0;
         }
-
-        count--;
-    } while (count > 0);
+    }
 
     return Dest;
 }
@@ -139,19 +219,23 @@ void *Ifx_CircularBuffer_read32(Ifx_CircularBuffer *buffer, void *data, Ifx_Size
 const void *Ifx_CircularBuffer_write8(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
 {
     const uint8 *source = (const uint8 *)data;
+    uint8       *base   = buffer->base;
+    Ifx_SizeT    blockSize;
 
-    do
+    /* Copy up to the end of the buffer, then wrap around as often as count requires */
+    while (count > 0)
     {
-        count--;
-        ((uint8 *)buffer->base)[buffer->index] = *source;
-        source                                 = &source[1];
-        buffer->index++;
+        blockSize     = __min(count, buffer->length - buffer->index);
+        Ifx_CircularBuffer_copy8(&base[buffer->index], source, blockSize);
+        source        = &source[blockSize];
+        count        -= blockSize;
+        buffer->index = (uint16)(buffer->index + blockSize);
 
         if (buffer->index >= buffer->length)
         {
             buffer->index = 0;
         }
-    } while (count > 0);
+    }
 
     return source;
 }
@@ -161,20 +245,22 @@ const void *Ifx_CircularBuffer_write32(Ifx_CircularBuffer *buffer, const void *d
 {
     const uint32 *source = (const uint32 *)data;
     uint8        *base   = buffer->base;
+    Ifx_SizeT     blockSize;
 
-    do
+    /* Copy up to the end of the buffer, then wrap around as often as count requires */
+    while (count > 0)
     {
-        *((uint32 *)(&base[buffer->index])) = *source;
-        source                              = &source[1];
-        buffer->index                       = buffer->index + 4;
+        blockSize     = __min(count, (buffer->length - buffer->index + 3) / 4);
+        Ifx_CircularBuffer_copy32((uint32 *)(&base[buffer->index]), source, blockSize);
+        source        = &source[blockSize];
+        count        -= blockSize;
+        buffer->index = (uint16)(buffer->index + (blockSize * 4));
 
         if (buffer->index >= buffer->length)
         {
             buffer->index = 0;
         }
-
-        count--;
-    } while (count > 0);
+    }
 
     return source;
 }
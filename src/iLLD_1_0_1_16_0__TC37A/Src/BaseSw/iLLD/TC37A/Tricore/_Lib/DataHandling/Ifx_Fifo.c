@@ -63,7 +63,39 @@
  * the interrupt is not disabled in the IntfifoXXX() functions
  * This is valid is an OS is used.
  *
+ * Lock-free mode (IFX_CFG_FIFO_LOCKFREE = 1):
+ * - the writer only modifies head, endIndex, writerWaitx, maxcount and sets eventReader
+ * - the reader only modifies tail, startIndex, readerWaitx and sets eventWriter
+ * - the fill level is head - tail, the buffer content is published with a release
+ * barrier before the index update, and consumed after an acquire barrier
+ * - the waiting side polls the fill level, the events are set for the wait hook
+ * and for observers (e.g. IfxStdIf_DPipe_getReadEvent())
+ *
+ * Wait hook:
+ * - without hook, the waiting side polls the event until the deadline
+ * - with hook, the waiting side calls waitHook->wait() until the event is set or the
+ * deadline is reached, the signaling side calls waitHook->notify() after setting the
+ * event, outside of the critical section
+ *
  */
+//------------------------------------------------------------------------------
+#if (IFX_CFG_FIFO_LOCKFREE)
+#ifndef IFX_FIFO_ACQUIRE
+/** \brief Barrier between the index read and the following buffer accesses */
+#define IFX_FIFO_ACQUIRE() __dsync()
+#endif
+
+#ifndef IFX_FIFO_RELEASE
+/** \brief Barrier between the buffer accesses and the following index update */
+#define IFX_FIFO_RELEASE() __dsync()
+#endif
+
+#ifndef IFX_FIFO_BARRIER
+/** \brief Barrier between the own index / wait count update and the read of the other side state */
+#define IFX_FIFO_BARRIER() __dsync()
+#endif
+#endif
+
 //------------------------------------------------------------------------------
 Ifx_Fifo *Ifx_Fifo_create(Ifx_SizeT size, Ifx_SizeT elementSize)
 {
@@ -101,6 +133,10 @@ Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
         fifo                     = (Ifx_Fifo *)buffer;
         fifo->eventReader        = FALSE;
         fifo->eventWriter        = TRUE;
+        fifo->waitHook           = NULL_PTR;
+        fifo->readerWake.signalTime = fifo->writerWake.signalTime = 0;
+        fifo->readerWake.last    = fifo->writerWake.last = 0;
+        fifo->readerWake.max     = fifo->writerWake.max = 0;
         fifo->buffer             = (uint8 *)Ifx_AlignOn64(((uint32)fifo) + sizeof(Ifx_Fifo));
         fifo->shared.count       = 0;
         fifo->shared.maxcount    = 0;
@@ -108,6 +144,10 @@ Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
         fifo->startIndex         = fifo->endIndex = 0;
         fifo->size               = size;
         fifo->elementSize        = elementSize;
+#if (IFX_CFG_FIFO_LOCKFREE)
+        fifo->head               = 0;
+        fifo->tail               = 0;
+#endif
     }
 
     return fifo;
@@ -119,8 +159,15 @@ Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
  */
 static Ifx_SizeT Ifx_Fifo_beginRead(Ifx_Fifo *fifo, Ifx_SizeT count)
 {
-    boolean   interruptState;
     Ifx_SizeT blockSize;
+#if (IFX_CFG_FIFO_LOCKFREE)
+    fifo->eventReader        = FALSE;
+    blockSize                = __min(count, Ifx_Fifo_readCount(fifo));
+    IFX_FIFO_ACQUIRE();
+    blockSize               -= blockSize % fifo->elementSize;
+    fifo->shared.readerWaitx = __min(count - blockSize, fifo->size);
+#else
+    boolean   interruptState;
 
     interruptState           = IfxCpu_disableInterrupts();
     blockSize                = __min(count, Ifx_Fifo_readCount(fifo));
@@ -128,11 +175,174 @@ static Ifx_SizeT Ifx_Fifo_beginRead(Ifx_Fifo *fifo, Ifx_SizeT count)
     fifo->eventReader        = FALSE;
     fifo->shared.readerWaitx = __min(count - blockSize, fifo->size);
     IfxCpu_restoreInterrupts(interruptState);
+#endif
 
     return blockSize;
 }
 
 
+/**
+ * Call the wait hook, if any. Without hook the caller polls the event
+ */
+static void Ifx_Fifo_wait(Ifx_Fifo *fifo, volatile boolean *event, Ifx_TickTime DeadLine)
+{
+    const Ifx_Fifo_WaitHook *hook = fifo->waitHook;
+
+    if ((hook != NULL_PTR) && (hook->wait != NULL_PTR))
+    {
+        hook->wait(hook->object, event, DeadLine);
+    }
+}
+
+
+/**
+ * Call the notify hook, if any
+ */
+static void Ifx_Fifo_notify(Ifx_Fifo *fifo, volatile boolean *event)
+{
+    const Ifx_Fifo_WaitHook *hook = fifo->waitHook;
+
+    if ((hook != NULL_PTR) && (hook->notify != NULL_PTR))
+    {
+        hook->notify(hook->object, event);
+    }
+}
+
+
+/**
+ * Update the wake up latency statistic, if the event was signaled after the wait start.
+ * The times are compared on the lower 32 bit of the system timer, relative to now, which is
+ * valid across the wrap around as long as the wait is shorter than 2^32 ticks
+ */
+static void Ifx_Fifo_updateWakeLatency(Ifx_Fifo_WakeLatency *latency, Ifx_TickTime waitStart)
+{
+    uint32 now         = (uint32)IfxStm_now();
+    uint32 sinceSignal = now - latency->signalTime;
+
+    if (sinceSignal <= (now - (uint32)waitStart))
+    {
+        latency->last = sinceSignal;
+
+        if (latency->last > latency->max)
+        {
+            latency->max = latency->last;
+        }
+    }
+}
+
+
+/**
+ * Wait for the reader event, return TRUE if the event is set before the deadline
+ */
+static boolean Ifx_Fifo_waitReader(Ifx_Fifo *fifo, Ifx_TickTime DeadLine)
+{
+#if (IFX_CFG_FIFO_LOCKFREE)
+    IFX_FIFO_BARRIER();
+
+    if (Ifx_Fifo_readCount(fifo) < fifo->shared.readerWaitx)
+    {
+        Ifx_TickTime waitStart = IfxStm_now();
+
+        while ((Ifx_Fifo_readCount(fifo) < fifo->shared.readerWaitx) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+        {
+            Ifx_Fifo_wait(fifo, &fifo->eventReader, DeadLine);
+        }
+
+        if (Ifx_Fifo_readCount(fifo) >= fifo->shared.readerWaitx)
+        {
+            Ifx_Fifo_updateWakeLatency(&fifo->readerWake, waitStart);
+        }
+    }
+
+    if (Ifx_Fifo_readCount(fifo) >= fifo->shared.readerWaitx)
+    {
+        fifo->eventReader = TRUE;
+    }
+
+#else
+
+    if (fifo->eventReader == FALSE)
+    {
+        Ifx_TickTime waitStart = IfxStm_now();
+
+        while ((fifo->eventReader == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+        {
+            Ifx_Fifo_wait(fifo, &fifo->eventReader, DeadLine);
+        }
+
+        if (fifo->eventReader != FALSE)
+        {
+            Ifx_Fifo_updateWakeLatency(&fifo->readerWake, waitStart);
+        }
+    }
+
+#endif
+
+    return fifo->eventReader;
+}
+
+
+/**
+ * Wait for the writer event, return TRUE if the event is set before the deadline
+ */
+static boolean Ifx_Fifo_waitWriter(Ifx_Fifo *fifo, Ifx_TickTime DeadLine)
+{
+#if (IFX_CFG_FIFO_LOCKFREE)
+    IFX_FIFO_BARRIER();
+
+    if (Ifx_Fifo_writeCount(fifo) < fifo->shared.writerWaitx)
+    {
+        Ifx_TickTime waitStart = IfxStm_now();
+
+        while ((Ifx_Fifo_writeCount(fifo) < fifo->shared.writerWaitx) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+        {
+            Ifx_Fifo_wait(fifo, &fifo->eventWriter, DeadLine);
+        }
+
+        if (Ifx_Fifo_writeCount(fifo) >= fifo->shared.writerWaitx)
+        {
+            Ifx_Fifo_updateWakeLatency(&fifo->writerWake, waitStart);
+        }
+    }
+
+    if (Ifx_Fifo_writeCount(fifo) >= fifo->shared.writerWaitx)
+    {
+        fifo->eventWriter = TRUE;
+    }
+
+#else
+
+    if (fifo->eventWriter == FALSE)
+    {
+        Ifx_TickTime waitStart = IfxStm_now();
+
+        while ((fifo->eventWriter == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+        {
+            Ifx_Fifo_wait(fifo, &fifo->eventWriter, DeadLine);
+        }
+
+        if (fifo->eventWriter != FALSE)
+        {
+            Ifx_Fifo_updateWakeLatency(&fifo->writerWake, waitStart);
+        }
+    }
+
+#endif
+
+    return fifo->eventWriter;
+}
+
+
+void Ifx_Fifo_setWaitHook(Ifx_Fifo *fifo, const Ifx_Fifo_WaitHook *hook)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+
+    /* Hook content visible before the pointer, which is published with a single aligned store */
+    __dsync();
+    fifo->waitHook = hook;
+}
+
+
 boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime timeout)
 {
     boolean result;
@@ -145,6 +355,13 @@ boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime time
     }
     else
     {
+#if (IFX_CFG_FIFO_LOCKFREE)
+        fifo->eventReader        = FALSE;
+        fifo->shared.readerWaitx = count;
+        result                   = Ifx_Fifo_waitReader(fifo, IfxStm_getDeadLine(timeout));
+        /* After the timeout, the reader is not waiting for any data */
+        fifo->shared.readerWaitx = 0;
+#else
         boolean interruptState;
         sint32  waitCount;
         interruptState = IfxCpu_disableInterrupts();
@@ -164,12 +381,12 @@ boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime time
             fifo->shared.readerWaitx = waitCount;
             IfxCpu_restoreInterrupts(interruptState);
 
-            while ((fifo->eventReader == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
-            {}
+            Ifx_Fifo_waitReader(fifo, DeadLine);
             /* After the timeout, the reader is not waiting for any data */
             fifo->shared.readerWaitx = 0;
             result = fifo->eventReader == TRUE;
         }
+#endif
     }
 
     return result;
@@ -181,6 +398,20 @@ boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime time
  */
 static Ifx_SizeT Ifx_Fifo_readEnd(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blockSize)
 {
+    boolean signal = FALSE;
+#if (IFX_CFG_FIFO_LOCKFREE)
+    IFX_FIFO_RELEASE();
+    fifo->tail += (uint32)blockSize;
+    IFX_FIFO_BARRIER();
+
+    if ((fifo->shared.writerWaitx != 0) && (Ifx_Fifo_writeCount(fifo) >= fifo->shared.writerWaitx))
+    {
+        fifo->writerWake.signalTime = (uint32)IfxStm_now();
+        fifo->eventWriter           = TRUE; /* Signal the writer */
+        signal                      = TRUE;
+    }
+
+#else
     boolean interruptState;
 
     /* Set the shared values */
@@ -194,12 +425,20 @@ static Ifx_SizeT Ifx_Fifo_readEnd(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blo
 
         if (fifo->shared.writerWaitx <= 0)
         {
-            fifo->shared.writerWaitx = 0;
-            fifo->eventWriter        = TRUE; /* Signal the writer */
+            fifo->shared.writerWaitx    = 0;
+            fifo->writerWake.signalTime = (uint32)IfxStm_now();
+            fifo->eventWriter           = TRUE; /* Signal the writer */
+            signal                      = TRUE;
         }
     }
 
     IfxCpu_restoreInterrupts(interruptState);
+#endif
+
+    if (signal != FALSE)
+    {
+        Ifx_Fifo_notify(fifo, &fifo->eventWriter);
+    }
 
     return count - blockSize;
 }
@@ -242,10 +481,7 @@ Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTim
 
             if (count != 0)
             {
-                while ((fifo->eventReader == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
-                {}
-
-                Stop = (fifo->eventReader == FALSE);    /* If the function timeout, the maximum number of characters are read before returning */
+                Stop = (Ifx_Fifo_waitReader(fifo, DeadLine) == FALSE);    /* If the function timeout, the maximum number of characters are read before returning */
             }
         } while (count != 0);
 
@@ -258,6 +494,25 @@ Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTim
 
 void Ifx_Fifo_clear(Ifx_Fifo *fifo)
 {
+#if (IFX_CFG_FIFO_LOCKFREE)
+    /* Drop the content seen by the reader, the writer may continue writing */
+    Ifx_SizeT count      = Ifx_Fifo_readCount(fifo);
+    Ifx_SizeT startIndex = fifo->startIndex + count;
+
+    if (startIndex >= fifo->size)
+    {
+        startIndex -= fifo->size;
+    }
+
+    fifo->eventReader        = FALSE;
+    fifo->shared.readerWaitx = 0;
+    fifo->startIndex         = startIndex;
+    IFX_FIFO_RELEASE();
+    fifo->tail              += (uint32)count;
+    fifo->eventWriter        = TRUE; /* Signal the writer */
+    Ifx_Fifo_notify(fifo, &fifo->eventWriter);
+#else
+    boolean signal = FALSE;
     boolean interruptState;
 
     interruptState = IfxCpu_disableInterrupts();
@@ -266,6 +521,7 @@ void Ifx_Fifo_clear(Ifx_Fifo *fifo)
     {
         fifo->shared.writerWaitx = 0;
         fifo->eventWriter        = TRUE; /* Signal the writer */
+        signal                   = TRUE;
     }
 
     fifo->eventReader        = FALSE;
@@ -274,12 +530,26 @@ void Ifx_Fifo_clear(Ifx_Fifo *fifo)
     fifo->shared.maxcount    = 0;
     fifo->startIndex         = fifo->endIndex;
     IfxCpu_restoreInterrupts(interruptState);
+
+    if (signal != FALSE)
+    {
+        Ifx_Fifo_notify(fifo, &fifo->eventWriter);
+    }
+
+#endif
 }
 
 
 static Ifx_SizeT Ifx_Fifo_beginWrite(Ifx_Fifo *fifo, Ifx_SizeT count)
 {
     Ifx_SizeT blockSize;
+#if (IFX_CFG_FIFO_LOCKFREE)
+    fifo->eventWriter        = FALSE;
+    blockSize                = __min(count, Ifx_Fifo_writeCount(fifo));
+    IFX_FIFO_ACQUIRE();
+    blockSize               -= blockSize % fifo->elementSize;
+    fifo->shared.writerWaitx = __min(count - blockSize, fifo->size);
+#else
     boolean   interruptState;
 
     interruptState           = IfxCpu_disableInterrupts();
@@ -288,6 +558,7 @@ static Ifx_SizeT Ifx_Fifo_beginWrite(Ifx_Fifo *fifo, Ifx_SizeT count)
     fifo->eventWriter        = FALSE;
     fifo->shared.writerWaitx = __min(count - blockSize, fifo->size);
     IfxCpu_restoreInterrupts(interruptState);
+#endif
 
     return blockSize;
 }
@@ -307,6 +578,13 @@ boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime tim
 
     else
     {
+#if (IFX_CFG_FIFO_LOCKFREE)
+        fifo->eventWriter        = FALSE;
+        fifo->shared.writerWaitx = count;
+        result                   = Ifx_Fifo_waitWriter(fifo, IfxStm_getDeadLine(timeout));
+        /* After the timeout, the writer is not waiting for any space */
+        fifo->shared.writerWaitx = 0;
+#else
         boolean interruptState;
         interruptState = IfxCpu_disableInterrupts();
 
@@ -324,12 +602,12 @@ boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime tim
             fifo->shared.writerWaitx = __max(0, count - (fifo->size - Ifx_Fifo_readCount(fifo)));
             IfxCpu_restoreInterrupts(interruptState);
 
-            while ((fifo->eventWriter == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
-            {}
+            Ifx_Fifo_waitWriter(fifo, DeadLine);
             /* After the timeout, the writer is not waiting for any space */
             fifo->shared.writerWaitx = 0;
             result = fifo->eventWriter == TRUE;
         }
+#endif
     }
 
     return result;
@@ -337,6 +615,21 @@ boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime tim
 
 static Ifx_SizeT Ifx_Fifo_endWrite(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blockSize)
 {
+    boolean signal = FALSE;
+#if (IFX_CFG_FIFO_LOCKFREE)
+    IFX_FIFO_RELEASE();
+    fifo->head           += (uint32)blockSize;
+    IFX_FIFO_BARRIER();
+    fifo->shared.maxcount = __max(fifo->shared.maxcount, Ifx_Fifo_readCount(fifo));   /* Update maximum value */
+
+    if ((fifo->shared.readerWaitx != 0) && (Ifx_Fifo_readCount(fifo) >= fifo->shared.readerWaitx))
+    {
+        fifo->readerWake.signalTime = (uint32)IfxStm_now();
+        fifo->eventReader           = TRUE; /* Signal the reader */
+        signal                      = TRUE;
+    }
+
+#else
     boolean interruptState;
 
     /* Set the shared values */
@@ -351,12 +644,20 @@ static Ifx_SizeT Ifx_Fifo_endWrite(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT bl
 
         if (fifo->shared.readerWaitx <= 0)
         {
-            fifo->shared.readerWaitx = 0;
-            fifo->eventReader        = TRUE; /* Signal the reader - a re-scheduling may occur at this point! */
+            fifo->shared.readerWaitx    = 0;
+            fifo->readerWake.signalTime = (uint32)IfxStm_now();
+            fifo->eventReader           = TRUE; /* Signal the reader - a re-scheduling may occur at this point! */
+            signal                      = TRUE;
         }
     }
 
     IfxCpu_restoreInterrupts(interruptState);
+#endif
+
+    if (signal != FALSE)
+    {
+        Ifx_Fifo_notify(fifo, &fifo->eventReader);
+    }
 
     return count - blockSize;
 }
@@ -400,10 +701,7 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
 
             if (count != 0)
             {
-                while ((fifo->eventWriter == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
-                {}
-
-                Stop = fifo->eventWriter == FALSE;  /* If the function timeout, the maximum number of characters are written before returning */
+                Stop = Ifx_Fifo_waitWriter(fifo, DeadLine) == FALSE;  /* If the function timeout, the maximum number of characters are written before returning */
             }
         } while (count != 0);
 
@@ -413,4 +711,98 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
     return count;
 }
 
+
+/**
+ * Set the span to the count bytes starting at index, wrapping at the end of the buffer
+ */
+static void Ifx_Fifo_getSpan(Ifx_Fifo *fifo, Ifx_SizeT index, Ifx_SizeT count, Ifx_Fifo_Span *span)
+{
+    Ifx_SizeT blockSize = __min(count, fifo->size - index);
+
+    span->data[0]  = &((uint8 *)fifo->buffer)[index];
+    span->count[0] = blockSize;
+    span->data[1]  = (uint8 *)fifo->buffer;
+    span->count[1] = count - blockSize;
+}
+
+
+/**
+ * Return index + count, wrapping at the end of the buffer
+ */
+static Ifx_SizeT Ifx_Fifo_advanceIndex(Ifx_Fifo *fifo, Ifx_SizeT index, Ifx_SizeT count)
+{
+    index += count;
+
+    if (index >= fifo->size)
+    {
+        index -= fifo->size;
+    }
+
+    return index;
+}
+
+
+Ifx_SizeT Ifx_Fifo_reserveWrite(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_Fifo_Span *span)
+{
+    Ifx_SizeT blockSize;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, span != NULL_PTR);
+
+    /* The free space can only increase until the commit, no critical section required */
+    blockSize  = __min(count, Ifx_Fifo_writeCount(fifo));
+#if (IFX_CFG_FIFO_LOCKFREE)
+    IFX_FIFO_ACQUIRE();
+#endif
+    blockSize -= blockSize % fifo->elementSize;
+    Ifx_Fifo_getSpan(fifo, fifo->endIndex, blockSize, span);
+
+    return blockSize;
+}
+
+
+void Ifx_Fifo_commitWrite(Ifx_Fifo *fifo, Ifx_SizeT count)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count % fifo->elementSize) == 0);
+
+    if (count != 0)
+    {
+        fifo->endIndex = Ifx_Fifo_advanceIndex(fifo, fifo->endIndex, count);
+        Ifx_Fifo_endWrite(fifo, count, count);
+    }
+}
+
+
+Ifx_SizeT Ifx_Fifo_peekRead(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_Fifo_Span *span)
+{
+    Ifx_SizeT blockSize;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, span != NULL_PTR);
+
+    /* The fill level can only increase until the release, no critical section required */
+    blockSize  = __min(count, Ifx_Fifo_readCount(fifo));
+#if (IFX_CFG_FIFO_LOCKFREE)
+    IFX_FIFO_ACQUIRE();
+#endif
+    blockSize -= blockSize % fifo->elementSize;
+    Ifx_Fifo_getSpan(fifo, fifo->startIndex, blockSize, span);
+
+    return blockSize;
+}
+
+
+void Ifx_Fifo_releaseRead(Ifx_Fifo *fifo, Ifx_SizeT count)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count % fifo->elementSize) == 0);
+
+    if (count != 0)
+    {
+        fifo->startIndex = Ifx_Fifo_advanceIndex(fifo, fifo->startIndex, count);
+        Ifx_Fifo_readEnd(fifo, count, count);
+    }
+}
+
 //------------------------------------------------------------------------------
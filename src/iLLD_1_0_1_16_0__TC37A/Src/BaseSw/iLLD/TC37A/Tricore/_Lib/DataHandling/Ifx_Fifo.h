@@ -51,34 +51,102 @@
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
 //------------------------------------------------------------------------------
 
+/** \brief Select the single producer / single consumer lock-free FIFO implementation
+ *
+ * When set to 1, the reader and the writer only communicate through the monotonic
+ * Ifx_Fifo.head / Ifx_Fifo.tail counters and memory barriers, the interrupts are
+ * never disabled. Exactly one reader and one writer context are allowed per FIFO,
+ * and \ref Ifx_Fifo_clear() must be called from the reader context.
+ */
+#ifndef IFX_CFG_FIFO_LOCKFREE
+#define IFX_CFG_FIFO_LOCKFREE (0)
+#endif
+
 /** Shared data of the FIFO
  *
  */
 typedef struct
 {
     Ifx_SizeT count;            /**< \brief number of bytes contained in the buffer */
-    sint32    readerWaitx;      /**< \brief Number of bytes that the reader is waiting for. When the writer modify it to 0 the reader get signaled */
-    sint32    writerWaitx;      /**< \brief Number of byte that the writer expect to be free. When the reader modify it to 0 the reader get signaled */
+    sint32    readerWaitx;      /**< \brief Number of bytes that the reader is waiting for. When the writer modify it to 0 the reader get signaled. In lock-free mode, fill level the reader is waiting for (only modified by the reader) */
+    sint32    writerWaitx;      /**< \brief Number of byte that the writer expect to be free. When the reader modify it to 0 the reader get signaled. In lock-free mode, free space the writer is waiting for (only modified by the writer) */
     Ifx_SizeT maxcount;         /**< \brief Highest value seen in the count */
 } Ifx_Fifo_Shared;
 
 /** \addtogroup IfxLld_lib_datahandling_fifo
  * \{ */
+/** \brief Wait function of the wait hook
+ *
+ * Called by the waiting reader / writer. Returns when *event is TRUE or when the deadline is
+ * reached. Spurious returns are allowed, the caller checks the event again.
+ * Typically implemented with an OS event / semaphore, or a condition variable on a host build.
+ *
+ * \param object Ifx_Fifo_WaitHook.object
+ * \param event Event waited for
+ * \param deadLine Deadline in system timer ticks
+ */
+typedef void (*Ifx_Fifo_WaitFunction)(void *object, volatile boolean *event, Ifx_TickTime deadLine);
+
+/** \brief Notify function of the wait hook
+ *
+ * Called by the signaling side after *event has been set to TRUE, with the interrupts enabled
+ * when called from thread level. May be called from an interrupt.
+ *
+ * \param object Ifx_Fifo_WaitHook.object
+ * \param event Event set
+ */
+typedef void (*Ifx_Fifo_NotifyFunction)(void *object, volatile boolean *event);
+
+/** \brief Wait / notify hook used instead of busy polling
+ */
+typedef struct
+{
+    Ifx_Fifo_WaitFunction   wait;           /**< \brief Wait function, NULL_PTR for busy polling */
+    Ifx_Fifo_NotifyFunction notify;         /**< \brief Notify function, may be NULL_PTR */
+    void                   *object;         /**< \brief Parameter passed to the hook functions */
+} Ifx_Fifo_WaitHook;
+
+/** \brief Time from the event signaling to the wake up of the waiting side, in system timer ticks
+ */
+typedef struct
+{
+    volatile uint32 signalTime;       /**< \brief Time of the last signal, lower 32 bit of the system timer (single access) */
+    Ifx_TickTime    last;             /**< \brief Latency of the last wake up */
+    Ifx_TickTime    max;              /**< \brief Highest latency seen */
+} Ifx_Fifo_WakeLatency;
+
 /** Fifo object
  *
  */
 typedef struct _Fifo
 {
-    void            *buffer;                /**< \brief aligned on 64 bit boundary */
-    Ifx_Fifo_Shared  shared;                /**< \brief  data shared between reader / writer */
-    Ifx_SizeT        startIndex;            /**< \brief buffer valid data start index */
-    Ifx_SizeT        endIndex;              /**< \brief buffer valid data end index */
-    Ifx_SizeT        size;                  /**< \brief multiple of 8 bit, max 0xFFF8 */
-    Ifx_SizeT        elementSize;           /**< \brief minimum number of bytes (block) added / removed to / from the buffer */
-    volatile boolean eventReader;           /**< \brief event set by the writer to signal the reader that the required data are available in the buffer */
-    volatile boolean eventWriter;           /**< \brief event set by the reader to signal the writer that the required free space are available in the buffer */
+    void                              *buffer;          /**< \brief aligned on 64 bit boundary */
+    Ifx_Fifo_Shared                   shared;           /**< \brief  data shared between reader / writer */
+    Ifx_SizeT                         startIndex;       /**< \brief buffer valid data start index */
+    Ifx_SizeT                         endIndex;         /**< \brief buffer valid data end index */
+    Ifx_SizeT                         size;             /**< \brief multiple of 8 bit, max 0xFFF8 */
+    Ifx_SizeT                         elementSize;      /**< \brief minimum number of bytes (block) added / removed to / from the buffer */
+    volatile boolean                  eventReader;      /**< \brief event set by the writer to signal the reader that the required data are available in the buffer */
+    volatile boolean                  eventWriter;      /**< \brief event set by the reader to signal the writer that the required free space are available in the buffer */
+    const Ifx_Fifo_WaitHook *volatile waitHook;         /**< \brief wait / notify hook, NULL_PTR if not set, see \ref Ifx_Fifo_setWaitHook() */
+    Ifx_Fifo_WakeLatency              readerWake;       /**< \brief latency from the write to the reader wake up */
+    Ifx_Fifo_WakeLatency              writerWake;       /**< \brief latency from the read to the writer wake up */
+#if (IFX_CFG_FIFO_LOCKFREE)
+    volatile uint32                   head;             /**< \brief total number of bytes written, only modified by the writer */
+    volatile uint32                   tail;             /**< \brief total number of bytes read, only modified by the reader */
+#endif
 } Ifx_Fifo;
 
+/** \brief Contiguous blocks of the FIFO buffer returned by \ref Ifx_Fifo_reserveWrite() and \ref Ifx_Fifo_peekRead()
+ *
+ * The second block is only used when the area wraps around the end of the buffer, its count is 0 otherwise.
+ */
+typedef struct
+{
+    uint8    *data[2];              /**< \brief start address of the blocks in the FIFO buffer */
+    Ifx_SizeT count[2];             /**< \brief number of bytes of the blocks */
+} Ifx_Fifo_Span;
+
 /** \brief Indicates if the required number of bytes are available in the buffer
  *
  * Should not be called from an interrupt as this function may wait forever
@@ -103,7 +171,23 @@ IFX_EXTERN boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_Ti
  */
 IFX_EXTERN boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime timeout);
 
+/** \brief Set the wait / notify hook
+ *
+ * By default (hook not set), the reader and writer busy poll the events until the timeout.
+ * With a hook, the waiting side can sleep or let other tasks run until notified.
+ * The hook is not copied, it shall stay valid as long as it is set. It is published with a single
+ * store, so that the function does not disable the interrupts.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param hook Hook to be used, NULL_PTR to restore the busy polling
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Fifo_setWaitHook(Ifx_Fifo *fifo, const Ifx_Fifo_WaitHook *hook);
+
 /** \brief Clear fifo contents.
+ *
+ * In lock-free mode (\ref IFX_CFG_FIFO_LOCKFREE), this function must be called by the reader.
  *
  * \param fifo Pointer on the Fifo object
  *
@@ -176,6 +260,51 @@ IFX_EXTERN Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count,
  */
 IFX_EXTERN Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout);
 
+/** \brief Reserve free space in the fifo to be filled in place
+ *
+ * The function does not wait, and can be called from an interrupt. Only complete elements
+ * are reserved. The reserved area is filled in by the caller (CPU or DMA) and made visible
+ * to the reader with \ref Ifx_Fifo_commitWrite().
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Requested number of bytes
+ * \param span Returns the reserved blocks
+ *
+ * \return Returns the number of bytes reserved, span->count[0] + span->count[1]
+ */
+IFX_EXTERN Ifx_SizeT Ifx_Fifo_reserveWrite(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_Fifo_Span *span);
+
+/** \brief Add the data written in place to the fifo
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Number of bytes written, multiple of elementSize and lower or equal to the value returned by \ref Ifx_Fifo_reserveWrite()
+ *
+ * \return None
+ */
+IFX_EXTERN void Ifx_Fifo_commitWrite(Ifx_Fifo *fifo, Ifx_SizeT count);
+
+/** \brief Get the data available in the fifo to be read in place
+ *
+ * The function does not wait, and can be called from an interrupt. Only complete elements
+ * are returned. The data stay in the fifo until \ref Ifx_Fifo_releaseRead() is called.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Requested number of bytes
+ * \param span Returns the blocks containing the data
+ *
+ * \return Returns the number of bytes available, span->count[0] + span->count[1]
+ */
+IFX_EXTERN Ifx_SizeT Ifx_Fifo_peekRead(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_Fifo_Span *span);
+
+/** \brief Remove the data read in place from the fifo
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Number of bytes read, multiple of elementSize and lower or equal to the value returned by \ref Ifx_Fifo_peekRead()
+ *
+ * \return None
+ */
+IFX_EXTERN void Ifx_Fifo_releaseRead(Ifx_Fifo *fifo, Ifx_SizeT count);
+
 /** \brief Empty the fifo
  *
  * \param fifo Pointer on the Fifo object
@@ -202,7 +331,11 @@ IFX_INLINE boolean Ifx_Fifo_flush(Ifx_Fifo *fifo, Ifx_TickTime timeout)
  */
 IFX_INLINE Ifx_SizeT Ifx_Fifo_readCount(Ifx_Fifo *fifo)
 {
+#if (IFX_CFG_FIFO_LOCKFREE)
+    return (Ifx_SizeT)(fifo->head - fifo->tail);
+#else
     return fifo->shared.count;
+#endif
 }
 
 
@@ -0,0 +1,396 @@
+/**
+ * \file Ifx_LargeFifo.c
+ * \brief Large FIFO functions
+ *
+ * \version iLLD_1_0_1_16_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "Ifx_LargeFifo.h"
+#include <stdlib.h>
+#include <string.h>
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Stm/Std/IfxStm.h"
+//------------------------------------------------------------------------------
+/*
+ * Note: same usage rules as Ifx_Fifo (one reader and one writer, main or interrupt).
+ * head is only modified by the writer and tail by the reader, the fill level is
+ * head - tail which is valid across the 32 bit wrap around as size <= 2^30. The size
+ * stays below 2^31 so that the sint32 readerWaitx / writerWaitx cannot overflow.
+ */
+//------------------------------------------------------------------------------
+Ifx_LargeFifo *Ifx_LargeFifo_create(uint32 size, uint32 elementSize)
+{
+    Ifx_LargeFifo *fifo = NULL_PTR;
+
+    fifo = malloc(size + sizeof(Ifx_LargeFifo) + 8); /* +8 because of padding in case the pointer is not aligned on 64 */
+
+    if (IFX_VALIDATE(IFX_VERBOSE_LEVEL_ERROR, (fifo != NULL_PTR)))
+    {
+        fifo = Ifx_LargeFifo_init(fifo, size, elementSize);
+    }
+
+    return fifo;
+}
+
+
+void Ifx_LargeFifo_destroy(Ifx_LargeFifo *fifo)
+{
+    free(fifo);
+}
+
+
+Ifx_LargeFifo *Ifx_LargeFifo_init(void *buffer, uint32 size, uint32 elementSize)
+{
+    Ifx_LargeFifo *fifo = (Ifx_LargeFifo *)buffer;
+
+    /* size must be a power of 2, for the index masking */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (size != 0) && ((size & (size - 1)) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (size < 0x80000000U));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (elementSize != 0) && (elementSize <= size));
+
+    fifo->buffer      = (uint8 *)Ifx_AlignOn64(((uint32)fifo) + sizeof(Ifx_LargeFifo));
+    fifo->head        = 0;
+    fifo->tail        = 0;
+    fifo->size        = size;
+    fifo->mask        = size - 1;
+    fifo->elementSize = elementSize;
+    fifo->maxcount    = 0;
+    fifo->readerWaitx = fifo->writerWaitx = 0;
+    fifo->eventReader = FALSE;
+    fifo->eventWriter = TRUE;
+
+    return fifo;
+}
+
+
+/**
+ * param: count in bytes
+ */
+static uint32 Ifx_LargeFifo_beginRead(Ifx_LargeFifo *fifo, uint32 count)
+{
+    boolean interruptState;
+    uint32  blockSize;
+
+    interruptState    = IfxCpu_disableInterrupts();
+    blockSize         = __minu(count, Ifx_LargeFifo_readCount(fifo));
+    blockSize        -= blockSize % fifo->elementSize;
+    fifo->eventReader = FALSE;
+    fifo->readerWaitx = (sint32)__minu(count - blockSize, fifo->size);
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return blockSize;
+}
+
+
+boolean Ifx_LargeFifo_canReadCount(Ifx_LargeFifo *fifo, uint32 count, Ifx_TickTime timeout)
+{
+    boolean result;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+
+    if ((count < fifo->elementSize) || (count > fifo->size))
+    {                           /* Only complete elements can be read from the buffer */
+        result = FALSE;
+    }
+    else
+    {
+        boolean interruptState;
+        interruptState = IfxCpu_disableInterrupts();
+
+        if (Ifx_LargeFifo_readCount(fifo) >= count)
+        {
+            fifo->readerWaitx = 0;
+            fifo->eventReader = TRUE;
+            IfxCpu_restoreInterrupts(interruptState);
+            result            = TRUE;
+        }
+        else
+        {
+            Ifx_TickTime DeadLine = IfxStm_getDeadLine(timeout);
+            fifo->eventReader = FALSE;
+            fifo->readerWaitx = (sint32)(count - Ifx_LargeFifo_readCount(fifo));
+            IfxCpu_restoreInterrupts(interruptState);
+
+            while ((fifo->eventReader == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+            {}
+
+            /* After the timeout, the reader is not waiting for any data */
+            fifo->readerWaitx = 0;
+            result            = fifo->eventReader == TRUE;
+        }
+    }
+
+    return result;
+}
+
+
+/**
+ * param: count in bytes
+ */
+static uint32 Ifx_LargeFifo_readEnd(Ifx_LargeFifo *fifo, uint32 count, uint32 blockSize)
+{
+    boolean interruptState;
+
+    /* Set the shared values */
+    interruptState = IfxCpu_disableInterrupts();
+
+    fifo->tail    += blockSize;
+
+    if (fifo->writerWaitx != 0)
+    {
+        fifo->writerWaitx -= (sint32)blockSize;
+
+        if (fifo->writerWaitx <= 0)
+        {
+            fifo->writerWaitx = 0;
+            fifo->eventWriter = TRUE; /* Signal the writer */
+        }
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return count - blockSize;
+}
+
+
+uint32 Ifx_LargeFifo_read(Ifx_LargeFifo *fifo, void *data, uint32 count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime DeadLine;
+    uint32       blockSize;
+    boolean      Stop = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
+
+    if (count != 0)
+    {
+        DeadLine = IfxStm_getDeadLine(timeout);
+
+        do
+        {
+            blockSize = Ifx_LargeFifo_beginRead(fifo, count);
+
+            if (blockSize != 0)
+            {
+                /* read elements from the buffer, up to the end of the buffer then from the start */
+                uint32 index = fifo->tail & fifo->mask;
+                uint32 first = __minu(blockSize, fifo->size - index);
+
+                memcpy(data, &fifo->buffer[index], first);
+                memcpy(&((uint8 *)data)[first], fifo->buffer, blockSize - first);
+                data  = &((uint8 *)data)[blockSize];
+                count = Ifx_LargeFifo_readEnd(fifo, count, blockSize);
+            }
+
+            if ((Stop != FALSE) || (IfxStm_isDeadLine(DeadLine) != FALSE))
+            {
+                /*When exiting, the reader is not waiting for any data */
+                fifo->readerWaitx = 0;
+                break;
+            }
+
+            if (count != 0)
+            {
+                while ((fifo->eventReader == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+                {}
+
+                Stop = (fifo->eventReader == FALSE);    /* If the function timeout, the maximum number of characters are read before returning */
+            }
+        } while (count != 0);
+    }
+
+    return count;
+}
+
+
+void Ifx_LargeFifo_clear(Ifx_LargeFifo *fifo)
+{
+    boolean interruptState;
+
+    interruptState = IfxCpu_disableInterrupts();
+
+    if (fifo->writerWaitx != 0)
+    {
+        fifo->writerWaitx = 0;
+        fifo->eventWriter = TRUE; /* Signal the writer */
+    }
+
+    fifo->eventReader = FALSE;
+    fifo->readerWaitx = 0;
+    fifo->maxcount    = 0;
+    fifo->tail        = fifo->head;
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+static uint32 Ifx_LargeFifo_beginWrite(Ifx_LargeFifo *fifo, uint32 count)
+{
+    uint32  blockSize;
+    boolean interruptState;
+
+    interruptState    = IfxCpu_disableInterrupts();
+    blockSize         = __minu(count, Ifx_LargeFifo_writeCount(fifo));
+    blockSize        -= blockSize % fifo->elementSize;
+    fifo->eventWriter = FALSE;
+    fifo->writerWaitx = (sint32)__minu(count - blockSize, fifo->size);
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return blockSize;
+}
+
+
+boolean Ifx_LargeFifo_canWriteCount(Ifx_LargeFifo *fifo, uint32 count, Ifx_TickTime timeout)
+{
+    boolean result;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+
+    if ((count < fifo->elementSize) || (count > fifo->size))
+    {                           /* Only complete elements can be written to the buffer */
+        result = FALSE;
+    }
+    else
+    {
+        boolean interruptState;
+        interruptState = IfxCpu_disableInterrupts();
+
+        if (Ifx_LargeFifo_writeCount(fifo) >= count)
+        {
+            fifo->writerWaitx = 0;
+            fifo->eventWriter = TRUE;
+            IfxCpu_restoreInterrupts(interruptState);
+            result            = TRUE;
+        }
+        else
+        {
+            Ifx_TickTime DeadLine = IfxStm_getDeadLine(timeout);
+            fifo->eventWriter = FALSE;
+            fifo->writerWaitx = (sint32)(count - Ifx_LargeFifo_writeCount(fifo));
+            IfxCpu_restoreInterrupts(interruptState);
+
+            while ((fifo->eventWriter == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+            {}
+
+            /* After the timeout, the writer is not waiting for any space */
+            fifo->writerWaitx = 0;
+            result            = fifo->eventWriter == TRUE;
+        }
+    }
+
+    return result;
+}
+
+
+static uint32 Ifx_LargeFifo_endWrite(Ifx_LargeFifo *fifo, uint32 count, uint32 blockSize)
+{
+    boolean interruptState;
+
+    /* Set the shared values */
+    interruptState = IfxCpu_disableInterrupts();
+
+    fifo->head    += blockSize;
+    fifo->maxcount = __maxu(fifo->maxcount, Ifx_LargeFifo_readCount(fifo));   /* Update maximum value */
+
+    if (fifo->readerWaitx != 0)
+    {
+        fifo->readerWaitx -= (sint32)blockSize;
+
+        if (fifo->readerWaitx <= 0)
+        {
+            fifo->readerWaitx = 0;
+            fifo->eventReader = TRUE; /* Signal the reader - a re-scheduling may occur at this point! */
+        }
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return count - blockSize;
+}
+
+
+uint32 Ifx_LargeFifo_write(Ifx_LargeFifo *fifo, const void *data, uint32 count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime DeadLine;
+    uint32       blockSize;
+    boolean      Stop = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
+
+    if (count != 0)
+    {
+        DeadLine = IfxStm_getDeadLine(timeout);
+
+        do
+        {
+            blockSize = Ifx_LargeFifo_beginWrite(fifo, count);
+
+            if (blockSize != 0)
+            {
+                /* write elements to the buffer, up to the end of the buffer then from the start */
+                uint32 index = fifo->head & fifo->mask;
+                uint32 first = __minu(blockSize, fifo->size - index);
+
+                memcpy(&fifo->buffer[index], data, first);
+                memcpy(fifo->buffer, &((const uint8 *)data)[first], blockSize - first);
+                data  = &((const uint8 *)data)[blockSize];
+                count = Ifx_LargeFifo_endWrite(fifo, count, blockSize);
+            }
+
+            if ((Stop != FALSE) || (IfxStm_isDeadLine(DeadLine) != FALSE))
+            {
+                /*When exiting, the writer is not waiting for any space */
+                fifo->writerWaitx = 0;
+                break;
+            }
+
+            if (count != 0)
+            {
+                while ((fifo->eventWriter == FALSE) && (IfxStm_isDeadLine(DeadLine) == FALSE))
+                {}
+
+                Stop = fifo->eventWriter == FALSE;  /* If the function timeout, the maximum number of characters are written before returning */
+            }
+        } while (count != 0);
+    }
+
+    return count;
+}
+
+//------------------------------------------------------------------------------
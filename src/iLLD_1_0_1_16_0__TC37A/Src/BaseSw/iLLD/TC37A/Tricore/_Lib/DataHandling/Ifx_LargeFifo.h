@@ -0,0 +1,229 @@
+/**
+ * \file Ifx_LargeFifo.h
+ * \brief Large FIFO buffer functions
+ * \ingroup IfxLld_lib_datahandling_largefifo
+ *
+ * \version iLLD_1_0_1_16_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup IfxLld_lib_datahandling_largefifo Large FIFO
+ * This module implements a FIFO buffer with 32 bit indexes for buffers bigger than 64KB.
+ * The buffer size is a power of 2, the buffer indexes are free running and masked on access.
+ * The reader / writer synchronization is the same as for \ref IfxLld_lib_datahandling_fifo.
+ * \ingroup IfxLld_lib_datahandling
+ *
+ */
+
+#ifndef IFX_LARGEFIFO_H
+#define IFX_LARGEFIFO_H 1
+//------------------------------------------------------------------------------
+#include "Ifx_Cfg.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//------------------------------------------------------------------------------
+
+/** \addtogroup IfxLld_lib_datahandling_largefifo
+ * \{ */
+/** Large fifo object
+ *
+ */
+typedef struct
+{
+    uint8           *buffer;                /**< \brief aligned on 64 bit boundary */
+    volatile uint32  head;                  /**< \brief total number of bytes written, the write index is head & mask */
+    volatile uint32  tail;                  /**< \brief total number of bytes read, the read index is tail & mask */
+    uint32           size;                  /**< \brief buffer size in bytes, power of 2 */
+    uint32           mask;                  /**< \brief size - 1 */
+    uint32           elementSize;           /**< \brief minimum number of bytes (block) added / removed to / from the buffer */
+    uint32           maxcount;              /**< \brief Highest value seen in the count */
+    sint32           readerWaitx;           /**< \brief Number of bytes that the reader is waiting for. When the writer modify it to 0 the reader get signaled */
+    sint32           writerWaitx;           /**< \brief Number of byte that the writer expect to be free. When the reader modify it to 0 the writer get signaled */
+    volatile boolean eventReader;           /**< \brief event set by the writer to signal the reader that the required data are available in the buffer */
+    volatile boolean eventWriter;           /**< \brief event set by the reader to signal the writer that the required free space are available in the buffer */
+} Ifx_LargeFifo;
+
+/** \brief Indicates if the required number of bytes are available in the buffer
+ *
+ * Should not be called from an interrupt as this function may wait forever
+ * \param fifo Pointer on the large fifo object
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return TRUE if at least count bytes can be read from the buffer, else
+ * the Event is armed to be set when the buffer count is bigger or equal to the requested count
+ */
+IFX_EXTERN boolean Ifx_LargeFifo_canReadCount(Ifx_LargeFifo *fifo, uint32 count, Ifx_TickTime timeout);
+
+/** \brief  Indicates if there is enough free space to write the data in the buffer
+ *
+ * Should not be called from an interrupt as this function may wait forever
+ *
+ * \param fifo Pointer on the large fifo object
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return TRUE if at least count bytes can be written to the buffer,
+ * if not the Event is armed to be set when the buffer free count is bigger or equal to the requested count
+ */
+IFX_EXTERN boolean Ifx_LargeFifo_canWriteCount(Ifx_LargeFifo *fifo, uint32 count, Ifx_TickTime timeout);
+
+/** \brief Clear fifo contents.
+ *
+ * \param fifo Pointer on the large fifo object
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_LargeFifo_clear(Ifx_LargeFifo *fifo);
+
+/** \brief Create a large fifo object
+ *
+ * The memory required for the object is allocated dynamically.
+ *
+ * \param size Specifies the FIFO buffer size in bytes, must be a power of 2, at most 2^30
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elementSize.
+ *
+ * \return returns a pointer to the FIFO object
+ *
+ * \see Ifx_LargeFifo_destroy()
+ */
+IFX_EXTERN Ifx_LargeFifo *Ifx_LargeFifo_create(uint32 size, uint32 elementSize);
+
+/** \brief Destroy the large fifo object
+ *
+ * This function must be called to destroy the fifo object when created with \ref Ifx_LargeFifo_create()
+ *
+ * \param fifo Pointer on the large fifo object
+ * \return void
+ *
+ * \see   Ifx_LargeFifo_create()
+ */
+IFX_EXTERN void Ifx_LargeFifo_destroy(Ifx_LargeFifo *fifo);
+
+/** \brief Initialize the large fifo object
+ *
+ * \param buffer Specifies the FIFO object address.
+ * \param size Specifies the FIFO buffer size in bytes, must be a power of 2, at most 2^30
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elementSize.
+ *
+ * \return Returns a pointer on the FIFO object
+ *
+ * \note: The buffer parameter must point on a free memory location where the
+ * buffer object will be initialised. The size of this area must be at least
+ * equals to "size + sizeof(Ifx_LargeFifo) + 8". Not taking this in account may result
+ * in unpredictable behavior.
+ */
+IFX_EXTERN Ifx_LargeFifo *Ifx_LargeFifo_init(void *buffer, uint32 size, uint32 elementSize);
+
+/** \brief Read data from a fifo and remove them from the buffer.
+ *
+ * Only complete elements are returned, if count is not a multiple of
+ * elementSize then the incomplete element is not read/removed from the buffer.
+ *
+ * \param fifo Pointer on the large fifo object
+ * \param data Pointer to the data buffer for storing values
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return return the number of byte that could not be read
+ */
+IFX_EXTERN uint32 Ifx_LargeFifo_read(Ifx_LargeFifo *fifo, void *data, uint32 count, Ifx_TickTime timeout);
+
+/** \brief Write data into a fifo.
+ *
+ * Only complete elements are written to the buffer, if count is not a multiple of
+ * elementSize then the incomplete element are not written to the buffer.
+ *
+ * \param fifo Pointer on the large fifo object
+ * \param data Pointer to the data buffer to write into the Fifo
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return return the number of byte that could not be written
+ */
+IFX_EXTERN uint32 Ifx_LargeFifo_write(Ifx_LargeFifo *fifo, const void *data, uint32 count, Ifx_TickTime timeout);
+
+/** \brief Empty the fifo
+ *
+ * \param fifo Pointer on the large fifo object
+ * \param timeout in system timer ticks
+ *
+ * \return TRUE if the buffer is emptied.
+ */
+IFX_INLINE boolean Ifx_LargeFifo_flush(Ifx_LargeFifo *fifo, Ifx_TickTime timeout)
+{
+    return Ifx_LargeFifo_canWriteCount(fifo, fifo->size, timeout);
+}
+
+
+/**
+ * \brief Returns the size of the data in the buffer in bytes
+ *
+ * \param fifo Pointer on the large fifo object
+ *
+ * \return Returns the size of the data in the buffer in bytes
+ */
+IFX_INLINE uint32 Ifx_LargeFifo_readCount(Ifx_LargeFifo *fifo)
+{
+    return fifo->head - fifo->tail;
+}
+
+
+/** \brief Returns the free size in bytes
+ *
+ * \param fifo Pointer on the large fifo object
+ *
+ * \return Returns the free size in bytes
+ */
+IFX_INLINE uint32 Ifx_LargeFifo_writeCount(Ifx_LargeFifo *fifo)
+{
+    return fifo->size - Ifx_LargeFifo_readCount(fifo);
+}
+
+
+/** \brief Indicates if the fifo is empty
+ *
+ * \param fifo Pointer on the large fifo object
+ *
+ * \retval TRUE is the buffer is empty
+ * \retval FALSE is the buffer is not empty
+ */
+IFX_INLINE boolean Ifx_LargeFifo_isEmpty(Ifx_LargeFifo *fifo)
+{
+    return (Ifx_LargeFifo_readCount(fifo) != 0) ? FALSE : TRUE;
+}
+
+
+/**\}*/
+//------------------------------------------------------------------------------
+#endif